@@ -110,19 +110,25 @@ endfunction()
 #   - This test class compares the output from a parallel simulation
 #     to the output from the serial instance of the same model.
 function(add_test_compare_parallel_simulation)
-  set(oneValueArgs CASENAME FILENAME SIMULATOR ABS_TOL REL_TOL DIR)
+  set(oneValueArgs CASENAME FILENAME SIMULATOR ABS_TOL REL_TOL DIR DIR_PREFIX PREFIX)
   set(multiValueArgs TEST_ARGS)
   cmake_parse_arguments(PARAM "$" "${oneValueArgs}" "${multiValueArgs}" ${ARGN} )
 
   if(NOT PARAM_DIR)
     set(PARAM_DIR ${PARAM_CASENAME})
   endif()
+  if(NOT PARAM_PREFIX)
+    set(PARAM_PREFIX compareParallelSim)
+  endif()
+  if(NOT PARAM_DIR_PREFIX)
+    set(PARAM_DIR_PREFIX /parallel)
+  endif()
 
-  set(RESULT_PATH ${BASE_RESULT_PATH}/parallel/${PARAM_SIMULATOR}+${PARAM_CASENAME})
+  set(RESULT_PATH ${BASE_RESULT_PATH}${PARAM_DIR_PREFIX}/${PARAM_SIMULATOR}+${PARAM_CASENAME})
   set(TEST_ARGS ${OPM_TESTS_ROOT}/${PARAM_DIR}/${PARAM_FILENAME} ${PARAM_TEST_ARGS})
 
   # Add test that runs flow_mpi and outputs the results to file
-  opm_add_test(compareParallelSim_${PARAM_SIMULATOR}+${PARAM_FILENAME} NO_COMPILE
+  opm_add_test(${PARAM_PREFIX}_${PARAM_SIMULATOR}+${PARAM_FILENAME} NO_COMPILE
                EXE_NAME ${PARAM_SIMULATOR}
                DRIVER_ARGS ${OPM_TESTS_ROOT}/${PARAM_DIR} ${RESULT_PATH}
                            ${PROJECT_BINARY_DIR}/bin
@@ -130,7 +136,7 @@ function(add_test_compare_parallel_simulation)
                            ${PARAM_ABS_TOL} ${PARAM_REL_TOL}
                            ${COMPARE_ECL_COMMAND}
                TEST_ARGS ${TEST_ARGS})
-  set_tests_properties(compareParallelSim_${PARAM_SIMULATOR}+${PARAM_FILENAME}
+  set_tests_properties(${PARAM_PREFIX}_${PARAM_SIMULATOR}+${PARAM_FILENAME}
                        PROPERTIES RUN_SERIAL 1)
 endfunction()
 
@@ -1095,4 +1101,15 @@ if(MPI_FOUND)
                                        REL_TOL ${rel_tol_parallel}
                                        DIR udq_actionx
                                        TEST_ARGS --linear-solver-reduction=1e-7 --tolerance-cnv=5e-6 --tolerance-mb=1e-6)
+
+  # The transmissibilities and NNCs in the INIT file must not depend on the
+  # domain decomposition.
+  opm_set_test_driver(${PROJECT_SOURCE_DIR}/tests/run-parallel-init-regressionTest.sh "")
+  add_test_compare_parallel_simulation(CASENAME norne
+                                       FILENAME NORNE_ATW2013
+                                       SIMULATOR flow
+                                       ABS_TOL ${abs_tol}
+                                       REL_TOL ${rel_tol}
+                                       PREFIX compareParallelInit
+                                       DIR_PREFIX /parallelInit)
 endif()
@@ -37,6 +37,11 @@
 #include <opm/grid/common/CartesianIndexMapper.hpp>
 #include <opm/parser/eclipse/EclipseState/Aquifer/NumericalAquifer/NumericalAquiferCell.hpp>
 #include <opm/simulators/flow/BlackoilModelParametersEbos.hpp>
+#include <opm/simulators/utils/CartesianToLocalMap.hpp>
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+
+#include <fmt/format.h>
 
 #include <array>
 #include <optional>
@@ -294,6 +299,7 @@ public:
     /*!
      * \brief Return compressed index from cartesian index
      *
+     * Returns -1 if the cell is not active on this process.
      */
     int compressedIndex(int cartesianCellIdx) const
     {
@@ -301,6 +307,12 @@ public:
         return index;
     }
 
+    /*!
+     * \brief Returns the mapping from cartesian to compressed cell indices.
+     */
+    const CartesianToLocalMap& cartesianToCompressed() const
+    { return cartesianToCompressed_; }
+
     /*!
      * \brief Extract Cartesian index triplet (i,j,k) of an active cell.
      *
@@ -394,10 +406,25 @@ protected:
     void updateCartesianToCompressedMapping_()
     {
         size_t num_cells = asImp_().grid().leafGridView().size(0);
-        cartesianToCompressed_.resize(cartesianSize(), -1);
+        std::vector<int> cartesianIndices(num_cells);
         for (unsigned i = 0; i < num_cells; ++i) {
-            unsigned cartesianCellIdx = cartesianIndex(i);
-            cartesianToCompressed_[cartesianCellIdx] = i;
+            cartesianIndices[i] = cartesianIndex(i);
+        }
+        cartesianToCompressed_ = CartesianToLocalMap(cartesianIndices);
+
+        // Report how much memory the compact mapping saves compared to an
+        // array over the logically cartesian grid on each process.
+        const auto& comm = asImp_().grid().comm();
+        double memoryUsage[2] = { static_cast<double>(cartesianToCompressed_.memoryUsage()),
+                                  static_cast<double>(cartesianSize() * sizeof(int)) };
+        comm.sum(memoryUsage, 2);
+        if (comm.rank() == 0) {
+            const double megaByte = 1024.0 * 1024.0;
+            OpmLog::info(fmt::format("Cartesian to compressed cell mapping uses {:.1f} MB "
+                                     "over all processes, saving {:.1f} MB per mapping "
+                                     "compared to cartesian sized index arrays.",
+                                     memoryUsage[0] / megaByte,
+                                     (memoryUsage[1] - memoryUsage[0]) / megaByte));
         }
     }
 
@@ -477,7 +504,7 @@ protected:
     /*! \brief Mapping between cartesian and compressed cells.
      *  It is initialized the first time it is called
      */
-    std::vector<int> cartesianToCompressed_;
+    CartesianToLocalMap cartesianToCompressed_;
 
     /*! \brief Cell center depths
      */
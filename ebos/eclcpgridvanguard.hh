@@ -112,17 +112,6 @@ public:
         globalTrans_.reset();
     }
 
-    const TransmissibilityType& globalTransmissibility() const
-    {
-        assert( globalTrans_ != nullptr );
-        return *globalTrans_;
-    }
-
-    void releaseGlobalTransmissibility()
-    {
-        globalTrans_.reset();
-    }
-
     /*!
      * \brief Distribute the simulation grid over multiple processes
      *
@@ -137,6 +126,9 @@ public:
                              this->schedule(), this->centroids_,
                              this->eclState(), this->parallelWells_);
 #endif
+        // the transmissibilities of the undistributed grid are only used
+        // as edge weights by the load balancer
+        globalTrans_.reset();
 
         this->allocCartMapper();
         this->updateGridView_();
@@ -93,10 +93,6 @@ void EclGenericCpGridVanguard<ElementMapper,GridView,Scalar>::doLoadBalance_(Dun
         // transmissibilities are relatively expensive to compute, we only do it if
         // more than a single process is involved in the simulation.
         cartesianIndexMapper_.reset(new CartesianIndexMapper(*grid_));
-        if (grid_->size(0))
-        {
-            this->allocTrans();
-        }
 
         // convert to transmissibility for faces
         // TODO: grid_->numFaces() is not generic. use grid_->size(1) instead? (might
@@ -107,6 +103,10 @@ void EclGenericCpGridVanguard<ElementMapper,GridView,Scalar>::doLoadBalance_(Dun
         int loadBalancerSet = externalLoadBalancer.has_value();
         grid_->comm().broadcast(&loadBalancerSet, 1, 0);
         if (!loadBalancerSet){
+            if (grid_->size(0))
+            {
+                this->allocTrans();
+            }
             faceTrans.resize(numFaces, 0.0);
             ElementMapper elemMapper(gridv, Dune::mcmgElementLayout());
             auto elemIt = gridView.template begin</*codim=*/0>();
@@ -276,12 +276,12 @@ void EclGenericCpGridVanguard<ElementMapper,GridView,Scalar>::doCreateGrids_(Ecl
     }
 #endif
 
-    // we use separate grid objects: one for the calculation of the initial condition
-    // via EQUIL and one for the actual simulation. The reason is that the EQUIL code
-    // is allergic to distributed grids and the simulation grid is distributed before
-    // the initial condition is calculated.
+    // we use separate grid objects: one holding the global view of the grid on the
+    // I/O rank, which is used to set up the output index mapping and to write the
+    // INIT file, and one for the actual simulation.
     // After loadbalance grid_ will contain a global and distribute view.
-    // equilGrid_being a shallow copy only the global view.
+    // equilGrid_being a shallow copy only the global view. It is released by
+    // releaseEquilGrid() once the INIT file has been written.
     if (mpiRank == 0)
     {
         equilGrid_.reset(new Dune::CpGrid(*grid_));
@@ -328,6 +328,7 @@ template<class ElementMapper, class GridView, class Scalar>
 const Dune::CpGrid& EclGenericCpGridVanguard<ElementMapper,GridView,Scalar>::equilGrid() const
 {
     assert(mpiRank == 0);
+    assert(equilGrid_);
     return *equilGrid_;
 }
 
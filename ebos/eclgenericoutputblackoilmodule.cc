@@ -33,6 +33,7 @@
 #include <opm/output/data/Solution.hpp>
 
 #include <opm/parser/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/RFTConfig.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Schedule.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/SummaryState.hpp>
 #include <opm/parser/eclipse/Units/Units.hpp>
@@ -58,6 +59,13 @@ std::string EclString(Opm::Inplace::Phase phase) {
     }
 }
 
+// Whether RFT or PLT output is requested for well wname at the report
+// step of rft_config.
+bool isRftRequested(const Opm::RFTConfig& rft_config, const std::string& wname)
+{
+    return rft_config.rft(wname) || rft_config.plt(wname);
+}
+
 }
 
 namespace Opm {
@@ -104,10 +112,11 @@ template<class FluidSystem, class Scalar>
 void EclGenericOutputBlackoilModule<FluidSystem,Scalar>::
 outputCumLog(size_t reportStepNum, const bool substep, bool forceDisableCumOutput)
 {
-    if (!substep) {
+    if (!substep && !forceDisableCumOutput) {
+        std::ostringstream ss;
         ScalarBuffer  tmp_values(WellCumDataType::numWCValues, 0.0);
         StringBuffer  tmp_names(WellCumDataType::numWCNames, "");
-        outputCumulativeReport_(tmp_values, tmp_names, forceDisableCumOutput);
+        outputCumulativeReport_(tmp_values, tmp_names, ss);
 
         const auto& st = summaryState_;
         for (const auto& gname: schedule_.groupNames()) {
@@ -131,7 +140,7 @@ outputCumLog(size_t reportStepNum, const bool substep, bool forceDisableCumOutpu
             tmp_values[8] = get("GGIT"); //WellCumDataType::GasInj
             tmp_values[9] = get("GVIT");//WellCumDataType::FluidResVolInj
 
-            outputCumulativeReport_(tmp_values, tmp_names, forceDisableCumOutput);
+            outputCumulativeReport_(tmp_values, tmp_names, ss);
         }
 
         for (const auto& wname : schedule_.wellNames(reportStepNum))  {
@@ -243,9 +252,11 @@ outputCumLog(size_t reportStepNum, const bool substep, bool forceDisableCumOutpu
             tmp_values[8] = get("WGIT"); //WellCumDataType::GasInj
             tmp_values[9] = get("WVIT");//WellCumDataType::FluidResVolInj
 
-            outputCumulativeReport_(tmp_values, tmp_names, forceDisableCumOutput);
+            outputCumulativeReport_(tmp_values, tmp_names, ss);
 
         }
+
+        OpmLog::note(ss.str());
     }
 }
 
@@ -255,10 +266,11 @@ outputProdLog(size_t reportStepNum,
               const bool substep,
               bool forceDisableProdOutput)
 {
-    if (!substep) {
+    if (!substep && !forceDisableProdOutput) {
+        std::ostringstream ss;
         ScalarBuffer  tmp_values(WellProdDataType::numWPValues, 0.0);
         StringBuffer  tmp_names(WellProdDataType::numWPNames, "");
-        outputProductionReport_(tmp_values, tmp_names, forceDisableProdOutput);
+        outputProductionReport_(tmp_values, tmp_names, ss);
 
         const auto& st = summaryState_;
 
@@ -282,7 +294,7 @@ outputProdLog(size_t reportStepNum,
             tmp_values[7] = get("GGOR"); //WellProdDataType::GasOilRatio
             tmp_values[8] = get("GWPR")/get("GGPR"); //WellProdDataType::WaterGasRatio
 
-            outputProductionReport_(tmp_values, tmp_names, forceDisableProdOutput);
+            outputProductionReport_(tmp_values, tmp_names, ss);
         }
 
         for (const auto& wname: schedule_.wellNames(reportStepNum)) {
@@ -347,8 +359,10 @@ outputProdLog(size_t reportStepNum,
             tmp_values[10] = get("WTHP"); //WellProdDataType::THP
             //tmp_values[11] = 0; //WellProdDataType::SteadyStatePI //
 
-            outputProductionReport_(tmp_values, tmp_names, forceDisableProdOutput);
+            outputProductionReport_(tmp_values, tmp_names, ss);
         }
+
+        OpmLog::note(ss.str());
     }
 }
 
@@ -356,10 +370,11 @@ template<class FluidSystem,class Scalar>
 void EclGenericOutputBlackoilModule<FluidSystem,Scalar>::
 outputInjLog(size_t reportStepNum, const bool substep, bool forceDisableInjOutput)
 {
-    if (!substep) {
+    if (!substep && !forceDisableInjOutput) {
+        std::ostringstream ss;
         ScalarBuffer  tmp_values(WellInjDataType::numWIValues, 0.0);
         StringBuffer  tmp_names(WellInjDataType::numWINames, "");
-        outputInjectionReport_(tmp_values, tmp_names, forceDisableInjOutput);
+        outputInjectionReport_(tmp_values, tmp_names, ss);
 
         const auto& st = summaryState_;
         for (const auto& gname: schedule_.groupNames()) {
@@ -379,7 +394,7 @@ outputInjLog(size_t reportStepNum, const bool substep, bool forceDisableInjOutpu
             tmp_values[4] = get("GGIR"); //WellInjDataType::GasRate
             tmp_values[5] = get("GVIR");//WellInjDataType::FluidResVol
 
-            outputInjectionReport_(tmp_values, tmp_names, forceDisableInjOutput);
+            outputInjectionReport_(tmp_values, tmp_names, ss);
         }
 
         for (const auto& wname: schedule_.wellNames(reportStepNum)) {
@@ -469,8 +484,10 @@ outputInjLog(size_t reportStepNum, const bool substep, bool forceDisableInjOutpu
             tmp_values[7] = get("WTHP"); //WellInjDataType::THP
             //tmp_values[8] = 0; //WellInjDataType::SteadyStateII
 
-            outputInjectionReport_(tmp_values, tmp_names, forceDisableInjOutput);
+            outputInjectionReport_(tmp_values, tmp_names, ss);
         }
+
+        OpmLog::note(ss.str());
     }
 }
 
@@ -500,6 +517,12 @@ void EclGenericOutputBlackoilModule<FluidSystem,Scalar>::
 addRftDataToWells(data::Wells& wellDatas, size_t reportStepNum)
 {
     const auto& rft_config = schedule_[reportStepNum].rft_config();
+    if (!rft_config.active()) {
+        // No RFT or PLT output requested at this report step, hence no
+        // connection data has been collected either.
+        return;
+    }
+
     for (const auto& well: schedule_.getWells(reportStepNum)) {
 
         // don't bother with wells not on this process
@@ -507,13 +530,14 @@ addRftDataToWells(data::Wells& wellDatas, size_t reportStepNum)
             continue;
         }
 
+        if (!isRftRequested(rft_config, well.name())) {
+            continue;
+        }
+
         //add data infrastructure for shut wells
         if (!wellDatas.count(well.name())) {
             data::Well wellData;
 
-            if (!rft_config.active())
-                continue;
-
             wellData.connections.resize(well.getConnections().size());
             size_t count = 0;
             for (const auto& connection: well.getConnections()) {
@@ -532,12 +556,12 @@ addRftDataToWells(data::Wells& wellDatas, size_t reportStepNum)
         data::Well& wellData = wellDatas.at(well.name());
         for (auto& connectionData: wellData.connections) {
             const auto index = connectionData.index;
-            if (oilConnectionPressures_.count(index) > 0)
-                connectionData.cell_pressure = oilConnectionPressures_.at(index);
-            if (waterConnectionSaturations_.count(index) > 0)
-                connectionData.cell_saturation_water = waterConnectionSaturations_.at(index);
-            if (gasConnectionSaturations_.count(index) > 0)
-                connectionData.cell_saturation_gas = gasConnectionSaturations_.at(index);
+            if (auto it = oilConnectionPressures_.find(index); it != oilConnectionPressures_.end())
+                connectionData.cell_pressure = it->second;
+            if (auto it = waterConnectionSaturations_.find(index); it != waterConnectionSaturations_.end())
+                connectionData.cell_saturation_water = it->second;
+            if (auto it = gasConnectionSaturations_.find(index); it != gasConnectionSaturations_.end())
+                connectionData.cell_saturation_gas = it->second;
         }
     }
     oilConnectionPressures_.clear();
@@ -847,9 +871,9 @@ doAllocBuffers(unsigned bufferSize,
         pressureTimesHydrocarbonVolume_.clear();
     }
 
-    // Well RFT data
-    if (!substep) {
-        const auto& rft_config = schedule_[reportStepNum].rft_config();
+    // Well RFT data, only for the wells with RFT or PLT output at this step
+    const auto& rft_config = schedule_[reportStepNum].rft_config();
+    if (!substep && rft_config.active()) {
         for (const auto& well: schedule_.getWells(reportStepNum)) {
 
             // don't bother with wells not on this process
@@ -857,7 +881,7 @@ doAllocBuffers(unsigned bufferSize,
                 continue;
             }
 
-            if (!rft_config.active())
+            if (!isRftRequested(rft_config, well.name()))
                 continue;
 
             for (const auto& connection: well.getConnections()) {
@@ -1172,11 +1196,12 @@ outputRegionFluidInPlace_(std::unordered_map<Inplace::Phase, Scalar> oip,
 template<class FluidSystem, class Scalar>
 void EclGenericOutputBlackoilModule<FluidSystem,Scalar>::
 outputProductionReport_(const ScalarBuffer& wellProd,
-                    const StringBuffer& wellProdNames,
-                    const bool forceDisableProdOutput)
+                        const StringBuffer& wellProdNames,
+                        std::ostream& os)
 {
-    if (forceDisableProdOutput)
-        return;
+    // The entries used to be logged one by one, each followed by a newline.
+    if (os.tellp() != std::streampos(0))
+        os << '\n';
 
     const UnitSystem& units = eclState_.getUnits();
     std::ostringstream ss;
@@ -1204,17 +1229,18 @@ outputProductionReport_(const ScalarBuffer& wellProd,
         }
         ss << ":"<< std::setfill ('-') << std::setw (9) << ":" << std::setfill ('-') << std::setw (12) << ":" << std::setfill ('-') << std::setw (5) << ":" << std::setfill ('-') << std::setw (12) << ":" << std::setfill ('-') << std::setw (12) << ":" << std::setfill ('-') << std::setw (12) << ":" << std::setfill ('-') << std::setw (12) << ":" << std::setfill ('-') << std::setw (12) << ":" << std::setfill ('-') << std::setw (11) << ":" << std::setfill ('-') << std::setw (13) << ":" << std::setfill ('-') << std::setw (9) << ":" << std::setfill ('-') << std::setw (9) << ":" << "\n";
     }
-    OpmLog::note(ss.str());
+    os << ss.str();
 }
 
 template<class FluidSystem, class Scalar>
 void EclGenericOutputBlackoilModule<FluidSystem,Scalar>::
 outputInjectionReport_(const ScalarBuffer& wellInj,
-                   const StringBuffer& wellInjNames,
-                   const bool forceDisableInjOutput)
+                       const StringBuffer& wellInjNames,
+                       std::ostream& os)
 {
-    if (forceDisableInjOutput)
-        return;
+    // The entries used to be logged one by one, each followed by a newline.
+    if (os.tellp() != std::streampos(0))
+        os << '\n';
 
     const UnitSystem& units = eclState_.getUnits();
     std::ostringstream ss;
@@ -1242,17 +1268,18 @@ outputInjectionReport_(const ScalarBuffer& wellInj,
         }
         ss << ":--------:-----------:------:------:------:------------:----------:-----------:-----------:--------:--------: \n";//--------------------:\n";
     }
-    OpmLog::note(ss.str());
+    os << ss.str();
 }
 
 template<class FluidSystem,class Scalar>
 void EclGenericOutputBlackoilModule<FluidSystem,Scalar>::
 outputCumulativeReport_(const ScalarBuffer& wellCum,
-                    const StringBuffer& wellCumNames,
-                    const bool forceDisableCumOutput)
+                        const StringBuffer& wellCumNames,
+                        std::ostream& os)
 {
-    if (forceDisableCumOutput)
-        return;
+    // The entries used to be logged one by one, each followed by a newline.
+    if (os.tellp() != std::streampos(0))
+        os << '\n';
 
     const UnitSystem& units = eclState_.getUnits();
     std::ostringstream ss;
@@ -1280,7 +1307,7 @@ outputCumulativeReport_(const ScalarBuffer& wellCum,
         }
         ss << ":--------:-----------:--------:----:------------:----------:-----------:-----------:------------:----------:-----------:-----------: \n";
     }
-    OpmLog::note(ss.str());
+    os << ss.str();
 }
 
 template<class FluidSystem,class Scalar>
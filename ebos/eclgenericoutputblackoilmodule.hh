@@ -28,6 +28,7 @@
 #define EWOMS_ECL_GENERIC_OUTPUT_BLACK_OIL_MODULE_HH
 
 #include <array>
+#include <iosfwd>
 #include <map>
 #include <numeric>
 #include <optional>
@@ -240,13 +241,13 @@ protected:
                                    const Scalar& pav, const int reg = 0) const;
     void outputProductionReport_(const ScalarBuffer& wellProd,
                                  const StringBuffer& wellProdNames,
-                                 const bool forceDisableProdOutput);
+                                 std::ostream& os);
     void outputInjectionReport_(const ScalarBuffer& wellInj,
                                 const StringBuffer& wellInjNames,
-                                const bool forceDisableInjOutput);
+                                std::ostream& os);
     void outputCumulativeReport_(const ScalarBuffer& wellCum,
                                  const StringBuffer& wellCumNames,
-                                 const bool forceDisableCumOutput);
+                                 std::ostream& os);
 
     void outputFipLogImpl(const Inplace& inplace) const;
 
@@ -32,6 +32,7 @@
 #include <opm/parser/eclipse/EclipseState/Tables/Eqldims.hpp>
 #include <opm/parser/eclipse/EclipseState/SimulationConfig/SimulationConfig.hpp>
 #include <opm/parser/eclipse/EclipseState/SimulationConfig/ThresholdPressure.hpp>
+#include <opm/simulators/utils/CartesianToLocalMap.hpp>
 
 #include <dune/grid/common/mcmgmapper.hh>
 
@@ -77,14 +78,11 @@ thresholdPressure(int elem1Idx, int elem2Idx) const
     if (enableExperiments_) {
         // threshold pressure accross faults
         if (!thpresftValues_.empty()) {
-            int cartElem1Idx = cartMapper_.cartesianIndex(elem1Idx);
-            int cartElem2Idx = cartMapper_.cartesianIndex(elem2Idx);
+            assert(0 <= elem1Idx && static_cast<int>(elemFaultIdx_.size()) > elem1Idx);
+            assert(0 <= elem2Idx && static_cast<int>(elemFaultIdx_.size()) > elem2Idx);
 
-            assert(0 <= cartElem1Idx && static_cast<int>(cartElemFaultIdx_.size()) > cartElem1Idx);
-            assert(0 <= cartElem2Idx && static_cast<int>(cartElemFaultIdx_.size()) > cartElem2Idx);
-
-            int fault1Idx = cartElemFaultIdx_[cartElem1Idx];
-            int fault2Idx = cartElemFaultIdx_[cartElem2Idx];
+            int fault1Idx = elemFaultIdx_[elem1Idx];
+            int fault2Idx = elemFaultIdx_[elem2Idx];
             if (fault1Idx != -1 && fault1Idx == fault2Idx)
                 // inside a fault there's no threshold pressure, even accross EQUIL
                 // regions.
@@ -221,9 +219,17 @@ extractThpresft_(const DeckKeyword& thpresftKeyword)
 
     // extract the multipliers from the deck keyword
     int numFaults = faults.size();
-    int numCartesianElem = eclState_.getInputGrid().getCartesianSize();
+    unsigned numElements = gridView_.size(/*codim=*/0);
     thpresftValues_.resize(numFaults, -1.0);
-    cartElemFaultIdx_.resize(numCartesianElem, -1);
+    elemFaultIdx_.resize(numElements, -1);
+
+    // the faults are given in terms of cartesian cells, map them to the
+    // local elements without an array over the whole cartesian grid
+    std::vector<int> cartesianIndices(numElements);
+    for (unsigned elemIdx = 0; elemIdx < numElements; ++elemIdx)
+        cartesianIndices[elemIdx] = cartMapper_.cartesianIndex(elemIdx);
+    const CartesianToLocalMap cartToElem(cartesianIndices);
+
     for (size_t recordIdx = 0; recordIdx < thpresftKeyword.size(); ++ recordIdx) {
         const DeckRecord& record = thpresftKeyword.getRecord(recordIdx);
 
@@ -239,8 +245,11 @@ extractThpresft_(const DeckKeyword& thpresftKeyword)
             for (const FaultFace& face: fault)
                 // "face" is a misnomer because the object describes a set of cell
                 // indices, but we go with the conventions of the parser here...
-                for (size_t cartElemIdx: face)
-                    cartElemFaultIdx_[cartElemIdx] = faultIdx;
+                for (size_t cartElemIdx: face) {
+                    const int elemIdx = cartToElem[cartElemIdx];
+                    if (elemIdx >= 0)
+                        elemFaultIdx_[elemIdx] = faultIdx;
+                }
         }
     }
 }
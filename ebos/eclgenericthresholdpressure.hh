@@ -100,7 +100,7 @@ protected:
 
     // threshold pressure accross faults. EXPERIMENTAL!
     std::vector<Scalar> thpresftValues_;
-    std::vector<int> cartElemFaultIdx_;
+    std::vector<int> elemFaultIdx_;
 
     bool enableThresholdPressure_;
     bool enableExperiments_;
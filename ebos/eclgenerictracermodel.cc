@@ -42,6 +42,7 @@
 #include <ebos/femcpgridcompat.hh>
 #endif
 
+#include <algorithm>
 #include <iostream>
 #include <set>
 #include <stdexcept>
@@ -201,13 +202,6 @@ doInit(bool enabled, size_t numGridDof,
             tracerMatrix_->addindex(dofIdx, *nIt);
     }
     tracerMatrix_->endindices();
-
-    const int sizeCartGrid = cartMapper_.cartesianSize();
-    cartToGlobal_.resize(sizeCartGrid);
-    for (unsigned i = 0; i < numGridDof; ++i) {
-        int cartIdx = cartMapper_.cartesianIndex(i);
-        cartToGlobal_[cartIdx] = i;
-    }
 }
 
 template<class Grid,class GridView, class DofMapper, class Stencil, class Scalar>
@@ -243,6 +237,91 @@ linearSolve_(const TracerMatrix& M, TracerVector& x, TracerVector& b)
     return result.converged;
 }
 
+template<class Grid,class GridView, class DofMapper, class Stencil, class Scalar>
+void EclGenericTracerModel<Grid,GridView,DofMapper,Stencil,Scalar>::
+setActiveCells_(int tracerIdx, const std::vector<unsigned>& cells)
+{
+    if (activeIndex_.empty())
+        activeIndex_.assign(tracerMatrix_->N(), -1);
+
+    // only the cells of the previous active set are numbered
+    if (activeTracer_ >= 0)
+        for (unsigned globalDofIdx : activeSets_[activeTracer_].cells)
+            activeIndex_[globalDofIdx] = -1;
+    activeTracer_ = tracerIdx;
+
+    auto& activeSet = activeSets_[tracerIdx];
+    const bool changed = !activeSet.matrix || cells != activeSet.cells;
+    if (changed)
+        activeSet.cells = cells;
+    const size_t numActive = activeSet.cells.size();
+    for (unsigned localIdx = 0; localIdx < numActive; ++localIdx)
+        activeIndex_[activeSet.cells[localIdx]] = localIdx;
+    tracerResidual_.resize(numActive);
+    if (!changed)
+        return;
+
+    // the pattern is the one of the full matrix restricted to the active cells
+    auto& matrix = activeSet.matrix;
+    matrix = std::make_unique<TracerMatrix>(numActive, numActive, TracerMatrix::random);
+    for (unsigned localIdx = 0; localIdx < numActive; ++localIdx) {
+        const auto& row = (*tracerMatrix_)[activeSet.cells[localIdx]];
+        size_t rowSize = 0;
+        for (auto col = row.begin(); col != row.end(); ++col)
+            if (activeIndex_[col.index()] >= 0)
+                ++rowSize;
+        matrix->setrowsize(localIdx, rowSize);
+    }
+    matrix->endrowsizes();
+    for (unsigned localIdx = 0; localIdx < numActive; ++localIdx) {
+        const auto& row = (*tracerMatrix_)[activeSet.cells[localIdx]];
+        for (auto col = row.begin(); col != row.end(); ++col)
+            if (activeIndex_[col.index()] >= 0)
+                matrix->addindex(localIdx, activeIndex_[col.index()]);
+    }
+    matrix->endindices();
+}
+
+template<class Grid,class GridView, class DofMapper, class Stencil, class Scalar>
+bool EclGenericTracerModel<Grid,GridView,DofMapper,Stencil,Scalar>::
+growActiveCells_(std::vector<unsigned>& cells, int numLayers) const
+{
+    std::vector<bool> isActive(tracerMatrix_->N(), false);
+    for (unsigned globalDofIdx : cells)
+        isActive[globalDofIdx] = true;
+
+    const size_t numCellsBefore = cells.size();
+    size_t layerBegin = 0;
+    for (int layer = 0; layer < numLayers; ++layer) {
+        const size_t layerEnd = cells.size();
+        for (size_t i = layerBegin; i < layerEnd; ++i) {
+            const auto& row = (*tracerMatrix_)[cells[i]];
+            for (auto col = row.begin(); col != row.end(); ++col) {
+                if (!isActive[col.index()]) {
+                    isActive[col.index()] = true;
+                    cells.push_back(col.index());
+                }
+            }
+        }
+        if (cells.size() == layerEnd)
+            break;
+        layerBegin = layerEnd;
+    }
+    std::sort(cells.begin(), cells.end());
+    return cells.size() > numCellsBefore;
+}
+
+template<class Grid,class GridView, class DofMapper, class Stencil, class Scalar>
+bool EclGenericTracerModel<Grid,GridView,DofMapper,Stencil,Scalar>::
+isActiveBoundary_(unsigned globalDofIdx) const
+{
+    const auto& row = (*tracerMatrix_)[globalDofIdx];
+    for (auto col = row.begin(); col != row.end(); ++col)
+        if (activeIndex_[col.index()] < 0)
+            return true;
+    return false;
+}
+
 #if HAVE_DUNE_FEM
 template class EclGenericTracerModel<Dune::CpGrid,
                                      Dune::GridView<Dune::Fem::GridPart2GridViewTraits<Dune::Fem::AdaptiveLeafGridPart<Dune::CpGrid, Dune::PartitionIteratorType(4), false>>>,
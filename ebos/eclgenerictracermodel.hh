@@ -37,6 +37,7 @@
 
 #include <dune/common/version.hh>
 
+#include <memory>
 #include <string>
 #include <vector>
 #include <iostream>
@@ -85,6 +86,26 @@ protected:
 
     bool linearSolve_(const TracerMatrix& M, TracerVector& x, TracerVector& b);
 
+    /*!
+     * \brief Restrict the system of a tracer to the given cells.
+     *
+     * Numbers the cells in activeIndex_. The matrix over the cells is
+     * kept per tracer and only rebuilt if the cells of the tracer changed.
+     */
+    void setActiveCells_(int tracerIdx, const std::vector<unsigned>& cells);
+
+    /*!
+     * \brief Add the neighbors of the given cells, numLayers times.
+     *
+     * \return false if no cell was added.
+     */
+    bool growActiveCells_(std::vector<unsigned>& cells, int numLayers) const;
+
+    /*!
+     * \brief Return true if the active cell has a neighbor outside the active set.
+     */
+    bool isActiveBoundary_(unsigned globalDofIdx) const;
+
     const GridView& gridView_;
     const EclipseState& eclState_;
     const CartesianIndexMapper& cartMapper_;
@@ -94,9 +115,23 @@ protected:
     std::vector<int> tracerPhaseIdx_;
     std::vector<Dune::BlockVector<Dune::FieldVector<Scalar, 1>>> tracerConcentration_;
     std::vector<Dune::BlockVector<Dune::FieldVector<Scalar, 1>>> tracerConcentrationInitial_;
+    // matrix over all cells. When the tracers are solved over active sets,
+    // only its sparsity pattern is used.
     TracerMatrix *tracerMatrix_;
+
+    // the system of a tracer restricted to its active cells
+    struct ActiveSet
+    {
+        std::vector<unsigned> cells;
+        std::unique_ptr<TracerMatrix> matrix;
+    };
+    // one active set per tracer, sized by the derived model if active sets
+    // are used
+    std::vector<ActiveSet> activeSets_;
+    // local index of the cells of the active set of activeTracer_, -1 elsewhere
+    std::vector<int> activeIndex_;
+    int activeTracer_ = -1;
     TracerVector tracerResidual_;
-    std::vector<int> cartToGlobal_;
     std::vector<Dune::BlockVector<Dune::FieldVector<Scalar, 1>>> storageOfTimeIndex1_;
 };
 
@@ -504,15 +504,22 @@ public:
                 }
             }
 
-            // Adding Well RFT data
-            if (this->oilConnectionPressures_.count(cartesianIdx) > 0) {
-                this->oilConnectionPressures_[cartesianIdx] = getValue(fs.pressure(oilPhaseIdx));
-            }
-            if (this->waterConnectionSaturations_.count(cartesianIdx) > 0) {
-                this->waterConnectionSaturations_[cartesianIdx] = getValue(fs.saturation(waterPhaseIdx));
-            }
-            if (this->gasConnectionSaturations_.count(cartesianIdx) > 0) {
-                this->gasConnectionSaturations_[cartesianIdx] = getValue(fs.saturation(gasPhaseIdx));
+            // Adding Well RFT data, the maps are only populated at report
+            // steps with RFT or PLT output
+            if (!this->oilConnectionPressures_.empty()) {
+                auto it = this->oilConnectionPressures_.find(cartesianIdx);
+                if (it != this->oilConnectionPressures_.end())
+                    it->second = getValue(fs.pressure(oilPhaseIdx));
+            }
+            if (!this->waterConnectionSaturations_.empty()) {
+                auto it = this->waterConnectionSaturations_.find(cartesianIdx);
+                if (it != this->waterConnectionSaturations_.end())
+                    it->second = getValue(fs.saturation(waterPhaseIdx));
+            }
+            if (!this->gasConnectionSaturations_.empty()) {
+                auto it = this->gasConnectionSaturations_.find(cartesianIdx);
+                if (it != this->gasConnectionSaturations_.end())
+                    it->second = getValue(fs.saturation(gasPhaseIdx));
             }
             if (this->wbpData_.count(cartesianIdx) > 0)
                 this->wbpData_[cartesianIdx] = getValue(fs.pressure(oilPhaseIdx));
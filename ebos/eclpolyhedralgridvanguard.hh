@@ -179,11 +179,6 @@ public:
     std::unordered_set<std::string> defunctWellNames() const
     { return defunctWellNames_; }
 
-    const TransmissibilityType& globalTransmissibility() const
-    {
-        return simulator_.problem().eclTransmissibilities();
-    }
-
 protected:
     void createGrids_()
     {
@@ -110,6 +110,8 @@
 
 #include <opm/common/OpmLog/OpmLog.hpp>
 
+#include <opm/simulators/utils/FirstTouch.hpp>
+
 #include <boost/date_time.hpp>
 
 #include <set>
@@ -560,6 +562,13 @@ struct EnableTracerModel<TypeTag, TTag::EclBaseProblem> {
     static constexpr bool value = false;
 };
 
+// solve the tracers over the whole grid by default
+template<class TypeTag>
+struct TracerActiveSetTolerance<TypeTag, TTag::EclBaseProblem> {
+    using type = GetPropType<TypeTag, Scalar>;
+    static constexpr type value = 0.0;
+};
+
 // By default, simulators derived from the EclBaseProblem are production simulators,
 // i.e., experimental features must be explicitly enabled at compile time
 template<class TypeTag>
@@ -706,6 +715,8 @@ public:
                              "The frequencies of which time steps are serialized to disk");
         EWOMS_REGISTER_PARAM(TypeTag, bool, EnableTracerModel,
                              "Transport tracers found in the deck.");
+        EWOMS_REGISTER_PARAM(TypeTag, Scalar, TracerActiveSetTolerance,
+                             "Solve each tracer only in the cells where its concentration exceeds this fraction of its largest concentration, and their neighbors. 0 solves over the whole grid");
         EWOMS_REGISTER_PARAM(TypeTag, bool, EclEnableDriftCompensation,
                              "Enable partial compensation of systematic mass losses via the source term of the next time step");
         if (enableExperiments)
@@ -917,8 +928,6 @@ public:
             maxDRs_.resize(ntpvt, 1e30);
             dRsDtOnlyFreeGas_.resize(ntpvt, false);
             lastRs_.resize(numDof, 0.0);
-            maxDRv_.resize(ntpvt, 1e30);
-            lastRv_.resize(numDof, 0.0);
             maxOilSaturation_.resize(numDof, 0.0);
             if (drsdtConvective_()) {
                 convectiveDrs_.resize(numDof, 1.0);
@@ -984,6 +993,11 @@ public:
 
         simulator.vanguard().releaseGlobalTransmissibilities();
 
+        // The initial condition is computed on the distributed grid, so the
+        // output index mapping and the INIT file were the last users of the
+        // undistributed grid kept on the I/O rank.
+        simulator.vanguard().releaseEquilGrid();
+
         // after finishing the initialization and writing the initial solution, we move
         // to the first "real" episode/report step
         // for restart the episode index and start is already set
@@ -2139,6 +2153,13 @@ public:
     const EclipseIO& eclIO() const
     { return eclWriter_->eclIO(); }
 
+    /*!
+     * \brief Returns the accumulated wall time spent writing report tables
+     *        to the log at the end of the time steps.
+     */
+    double logOutputTime() const
+    { return eclWriter_ ? eclWriter_->logOutputTime() : 0.0; }
+
     bool vapparsActive() const
     {
         const auto& simulator = this->simulator();
@@ -2763,7 +2784,15 @@ private:
 
         size_t numDof = this->model().numGridDof();
 
-        referencePorosity_[/*timeIdx=*/0].resize(numDof);
+        if (referencePorosity_[/*timeIdx=*/0].size() != numDof) {
+            // the porosity is read for every element in every linearization;
+            // spread its pages over the NUMA nodes of the threads. Both time
+            // levels are allocated here, so that copying the porosity to the
+            // previous time level reuses these pages.
+            for (auto& porosity : referencePorosity_) {
+                firstTouchAssign(porosity, numDof, 0.0);
+            }
+        }
 
         const auto& fp = eclState.fieldProps();
         const std::vector<double> porvData = fp.porv(false);
@@ -3279,12 +3308,8 @@ private:
         if (bcconfig.size() > 0) {
             nonTrivialBoundaryConditions_ = true;
 
-            size_t numCartDof = vanguard.cartesianSize();
             unsigned numElems = vanguard.gridView().size(/*codim=*/0);
-            std::vector<int> cartesianToCompressedElemIdx(numCartDof, -1);
-
-            for (unsigned elemIdx = 0; elemIdx < numElems; ++elemIdx)
-                cartesianToCompressedElemIdx[vanguard.cartesianIndex(elemIdx)] = elemIdx;
+            const auto& cartesianToCompressedElemIdx = vanguard.cartesianToCompressed();
 
             massratebcXMinus_.resize(numElems, 0.0);
             massratebcX_.resize(numElems, 0.0);
@@ -3455,7 +3480,7 @@ private:
 
     static std::string briefDescription_;
 
-    std::array<std::vector<Scalar>, 2> referencePorosity_;
+    std::array<FirstTouchVector<Scalar>, 2> referencePorosity_;
     typename Vanguard::TransmissibilityType transmissibilities_;
 
     std::shared_ptr<EclMaterialLawManager> materialLawManager_;
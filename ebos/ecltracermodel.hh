@@ -32,6 +32,8 @@
 
 #include <opm/models/utils/propertysystem.hh>
 
+#include <algorithm>
+#include <cmath>
 #include <string>
 #include <vector>
 
@@ -42,6 +44,11 @@ struct EnableTracerModel {
     using type = UndefinedProperty;
 };
 
+template<class TypeTag, class MyTypeTag>
+struct TracerActiveSetTolerance {
+    using type = UndefinedProperty;
+};
+
 } // namespace Opm::Properties
 
 namespace Opm {
@@ -101,6 +108,9 @@ public:
         bool enabled = EWOMS_GET_PARAM(TypeTag, bool, EnableTracerModel);
         this->doInit(enabled, simulator_.model().numGridDof(),
                      gasPhaseIdx, oilPhaseIdx, waterPhaseIdx);
+        activeSetTolerance_ = EWOMS_GET_PARAM(TypeTag, Scalar, TracerActiveSetTolerance);
+        if (activeSetTolerance_ > 0.0)
+            this->activeSets_.resize(this->numTracers());
     }
 
     void beginTimeStep()
@@ -110,11 +120,23 @@ public:
 
         this->tracerConcentrationInitial_ = this->tracerConcentration_;
 
-        // compute storageCache
+        // compute storageCache. The storage vanishes in cells without
+        // tracer, which are skipped when the active set is used.
+        const auto& dofMapper = simulator_.model().dofMapper();
         ElementContext elemCtx(simulator_);
         auto elemIt = simulator_.gridView().template begin</*codim=*/0>();
         auto elemEndIt = simulator_.gridView().template end</*codim=*/0>();
         for (; elemIt != elemEndIt; ++ elemIt) {
+            if (activeSetTolerance_ > 0.0) {
+                const unsigned globalDofIdx = dofMapper.index(*elemIt);
+                bool hasTracer = false;
+                for (int tracerIdx = 0; tracerIdx < this->numTracers(); ++ tracerIdx) {
+                    this->storageOfTimeIndex1_[tracerIdx][globalDofIdx] = 0.0;
+                    hasTracer = hasTracer || this->tracerConcentrationInitial_[tracerIdx][globalDofIdx] != 0.0;
+                }
+                if (!hasTracer)
+                    continue;
+            }
             elemCtx.updateAll(*elemIt);
             int globalDofIdx = elemCtx.globalSpaceIndex(0, 0);
             for (int tracerIdx = 0; tracerIdx < this->numTracers(); ++ tracerIdx){
@@ -134,16 +156,36 @@ public:
             return;
 
         for (int tracerIdx = 0; tracerIdx < this->numTracers(); ++ tracerIdx){
+            if (activeSetTolerance_ <= 0.0) {
+                solveTracer_(tracerIdx);
+                continue;
+            }
 
-            typename BaseType::TracerVector dx(this->tracerResidual_.size());
-            // Newton step (currently the system is linear, converge in one iteration)
-            for (int iter = 0; iter < 5; ++ iter){
-                linearize_(tracerIdx);
-                this->linearSolve_(*this->tracerMatrix_, dx, this->tracerResidual_);
-                this->tracerConcentration_[tracerIdx] -= dx;
-
-                if (dx.two_norm()<1e-2)
+            // Solve over the cells with tracer, the cells of the injectors
+            // and a layer of neighbors around them. If the tracer reaches
+            // the boundary of this set, restart from a larger set.
+            const Scalar threshold = activeSetTolerance_ * maxConcentration_(tracerIdx);
+            std::vector<unsigned> cells = initialActiveCells_(tracerIdx, threshold);
+            if (cells.empty())
+                continue; // no tracer in the reservoir and none injected
+            int numLayers = 1;
+            this->growActiveCells_(cells, numLayers);
+            const auto& activeCells = this->activeSets_[tracerIdx].cells;
+            while (true) {
+                this->setActiveCells_(tracerIdx, cells);
+                solveTracer_(tracerIdx);
+
+                const auto& concentration = this->tracerConcentration_[tracerIdx];
+                const bool reachedBoundary =
+                    std::any_of(activeCells.begin(), activeCells.end(),
+                                [&](unsigned I) { return std::abs(concentration[I][0]) > threshold
+                                                         && this->isActiveBoundary_(I); });
+                numLayers *= 2;
+                if (!reachedBoundary || !this->growActiveCells_(cells, numLayers))
                     break;
+
+                for (unsigned I : activeCells)
+                    this->tracerConcentration_[tracerIdx][I] = this->tracerConcentrationInitial_[tracerIdx][I];
             }
         }
     }
@@ -167,6 +209,87 @@ public:
     { /* not implemented */ }
 
 protected:
+    // Newton iterations for one tracer over its active cells, or over the
+    // whole grid if active sets are not used
+    void solveTracer_(const int tracerIdx)
+    {
+        typename BaseType::TracerVector dx(this->tracerResidual_.size());
+        // Newton step (currently the system is linear, converge in one iteration)
+        for (int iter = 0; iter < 5; ++ iter){
+            linearize_(tracerIdx);
+            if (activeSetTolerance_ <= 0.0) {
+                this->linearSolve_(*this->tracerMatrix_, dx, this->tracerResidual_);
+                this->tracerConcentration_[tracerIdx] -= dx;
+            }
+            else {
+                const auto& activeSet = this->activeSets_[tracerIdx];
+                this->linearSolve_(*activeSet.matrix, dx, this->tracerResidual_);
+                for (unsigned localIdx = 0; localIdx < activeSet.cells.size(); ++localIdx)
+                    this->tracerConcentration_[tracerIdx][activeSet.cells[localIdx]] -= dx[localIdx];
+            }
+
+            if (dx.two_norm()<1e-2)
+                break;
+        }
+    }
+
+    // index of a cell in the tracer system, -1 if the cell is not active
+    int localIndex_(unsigned globalDofIdx) const
+    {
+        if (activeSetTolerance_ <= 0.0)
+            return globalDofIdx;
+        return this->activeIndex_[globalDofIdx];
+    }
+
+    // largest concentration in the reservoir or injected by a well
+    Scalar maxConcentration_(const int tracerIdx) const
+    {
+        Scalar maxConcentration = this->tracerConcentrationInitial_[tracerIdx].infinity_norm();
+        const auto& wells = simulator_.vanguard().schedule().getWells(simulator_.episodeIndex());
+        for (const auto& well : wells) {
+            if (well.getStatus() == Well::Status::SHUT || !well.isInjector())
+                continue;
+            const Scalar wtracer = well.getTracerProperties().getConcentration(this->tracerNames_[tracerIdx]);
+            maxConcentration = std::max(maxConcentration, std::abs(wtracer));
+        }
+        return maxConcentration;
+    }
+
+    // cells with tracer above the threshold and the cells of the injectors
+    // of the tracer, sorted
+    std::vector<unsigned> initialActiveCells_(const int tracerIdx, const Scalar threshold) const
+    {
+        std::vector<unsigned> cells;
+        const auto& concentration = this->tracerConcentrationInitial_[tracerIdx];
+        for (unsigned I = 0; I < concentration.size(); ++I)
+            if (std::abs(concentration[I][0]) > threshold)
+                cells.push_back(I);
+
+        const auto& wells = simulator_.vanguard().schedule().getWells(simulator_.episodeIndex());
+        for (const auto& well : wells) {
+            if (well.getStatus() == Well::Status::SHUT || !well.isInjector())
+                continue;
+            const Scalar wtracer = well.getTracerProperties().getConcentration(this->tracerNames_[tracerIdx]);
+            if (!(std::abs(wtracer) > threshold))
+                continue;
+            std::array<int, 3> cartesianCoordinate;
+            for (auto& connection : well.getConnections()) {
+                if (connection.state() == Connection::State::SHUT)
+                    continue;
+                cartesianCoordinate[0] = connection.getI();
+                cartesianCoordinate[1] = connection.getJ();
+                cartesianCoordinate[2] = connection.getK();
+                const size_t cartIdx = simulator_.vanguard().cartesianIndex(cartesianCoordinate);
+                const int I = simulator_.vanguard().compressedIndex(cartIdx);
+                if (I >= 0)
+                    cells.push_back(I);
+            }
+        }
+        std::sort(cells.begin(), cells.end());
+        cells.erase(std::unique(cells.begin(), cells.end()), cells.end());
+        return cells;
+    }
+
     // evaluate storage term for all tracers in a single cell
     template <class LhsEval>
     void computeStorage_(LhsEval& tracerStorage,
@@ -229,17 +352,21 @@ protected:
 
     }
 
+    // linearize over the active cells, in their local numbering
     void linearize_(int tracerIdx)
     {
-        (*this->tracerMatrix_) = 0.0;
+        auto& matrix = activeSetTolerance_ <= 0.0 ? *this->tracerMatrix_ : *this->activeSets_[tracerIdx].matrix;
+        matrix = 0.0;
         this->tracerResidual_ = 0.0;
 
-        size_t numGridDof =  simulator_.model().numGridDof();
-        std::vector<double> volumes(numGridDof, 0.0);
+        const auto& dofMapper = simulator_.model().dofMapper();
         ElementContext elemCtx(simulator_);
         auto elemIt = simulator_.gridView().template begin</*codim=*/0>();
         auto elemEndIt = simulator_.gridView().template end</*codim=*/0>();
         for (; elemIt != elemEndIt; ++ elemIt) {
+            const int i = localIndex_(dofMapper.index(*elemIt));
+            if (i < 0)
+                continue;
             elemCtx.updateAll(*elemIt);
 
             Scalar extrusionFactor =
@@ -253,7 +380,6 @@ protected:
             Scalar dt = elemCtx.simulator().timeStepSize();
 
             size_t I = elemCtx.globalSpaceIndex(/*dofIdx=*/ 0, /*timIdx=*/0);
-            volumes[I] = scvVolume;
             TracerEvaluation localStorage;
             TracerEvaluation storageOfTimeIndex0;
             Scalar storageOfTimeIndex1;
@@ -264,8 +390,8 @@ protected:
                 computeStorage_(storageOfTimeIndex1, elemCtx, 0, /*timIdx=*/1, tracerIdx);
 
             localStorage = (storageOfTimeIndex0 - storageOfTimeIndex1) * scvVolume/dt;
-            this->tracerResidual_[I][0] += localStorage.value(); //residual + flux
-            (*this->tracerMatrix_)[I][I][0][0] = localStorage.derivative(0);
+            this->tracerResidual_[i][0] += localStorage.value(); //residual + flux
+            matrix[i][i][0][0] = localStorage.derivative(0);
             size_t numInteriorFaces = elemCtx.numInteriorFaces(/*timIdx=*/0);
             for (unsigned scvfIdx = 0; scvfIdx < numInteriorFaces; scvfIdx++) {
                 TracerEvaluation flux;
@@ -273,9 +399,13 @@ protected:
                 unsigned j = face.exteriorIndex();
                 unsigned J = elemCtx.globalSpaceIndex(/*dofIdx=*/ j, /*timIdx=*/0);
                 computeFlux_(flux, elemCtx, scvfIdx, 0, tracerIdx);
-                this->tracerResidual_[I][0] += flux.value(); //residual + flux
-                (*this->tracerMatrix_)[J][I][0][0] = -flux.derivative(0);
-                (*this->tracerMatrix_)[I][J][0][0] = flux.derivative(0);
+                this->tracerResidual_[i][0] += flux.value(); //residual + flux
+                // the flux into an inactive cell only enters the residual
+                const int jLocal = localIndex_(J);
+                if (jLocal < 0)
+                    continue;
+                matrix[jLocal][i][0][0] = -flux.derivative(0);
+                matrix[i][jLocal][0][0] = flux.derivative(0);
             }
 
         }
@@ -283,12 +413,15 @@ protected:
         // Wells
         const int episodeIdx = simulator_.episodeIndex();
         const auto& wells = simulator_.vanguard().schedule().getWells(episodeIdx);
+        const auto& wellModel = simulator_.problem().wellModel();
         for (const auto& well : wells) {
 
             if (well.getStatus() == Well::Status::SHUT)
                 continue;
 
             const double wtracer = well.getTracerProperties().getConcentration(this->tracerNames_[tracerIdx]);
+            // looked up at the first connection of the well in this process
+            decltype(wellModel.well(well.name())) wellPtr;
             std::array<int, 3> cartesianCoordinate;
             for (auto& connection : well.getConnections()) {
 
@@ -299,17 +432,24 @@ protected:
                 cartesianCoordinate[1] = connection.getJ();
                 cartesianCoordinate[2] = connection.getK();
                 const size_t cartIdx = simulator_.vanguard().cartesianIndex(cartesianCoordinate);
-                const int I = this->cartToGlobal_[cartIdx];
-                Scalar rate = simulator_.problem().wellModel().well(well.name())->volumetricSurfaceRateForConnection(I, this->tracerPhaseIdx_[tracerIdx]);
+                const int I = simulator_.vanguard().compressedIndex(cartIdx);
+                if (I < 0 || localIndex_(I) < 0)
+                    continue;
+
+                const int i = localIndex_(I);
+                if (!wellPtr)
+                    wellPtr = wellModel.well(well.name());
+                Scalar rate = wellPtr->volumetricSurfaceRateForConnection(I, this->tracerPhaseIdx_[tracerIdx]);
                 if (rate > 0)
-                    this->tracerResidual_[I][0] -= rate*wtracer;
+                    this->tracerResidual_[i][0] -= rate*wtracer;
                 else if (rate < 0)
-                    this->tracerResidual_[I][0] -= rate*this->tracerConcentration_[tracerIdx][I];
+                    this->tracerResidual_[i][0] -= rate*this->tracerConcentration_[tracerIdx][I];
             }
         }
     }
 
     Simulator& simulator_;
+    Scalar activeSetTolerance_ = 0.0;
 };
 
 } // namespace Opm
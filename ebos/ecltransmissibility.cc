@@ -472,18 +472,16 @@ update(bool global)
     updateFromEclState_(global);
 
     // Create mapping from global to local index
-    const size_t cartesianSize = cartMapper_.cartesianSize();
-    // reserve memory
-    std::vector<int> globalToLocal(cartesianSize, -1);
+    std::vector<int> cartesianIndices(grid_.leafGridView().size(/*codim=*/0), -1);
 
     // loop over all elements (global grid) and store Cartesian index
     elemIt = grid_.leafGridView().template begin<0>();
 
     for (; elemIt != elemEndIt; ++elemIt) {
         int elemIdx = elemMapper.index(*elemIt);
-        int cartElemIdx = cartMapper_.cartesianIndex(elemIdx);
-        globalToLocal[cartElemIdx] = elemIdx;
+        cartesianIndices[elemIdx] = cartMapper_.cartesianIndex(elemIdx);
     }
+    const CartesianToLocalMap globalToLocal(cartesianIndices);
     applyEditNncToGridTrans_(globalToLocal);
     applyNncToGridTrans_(globalToLocal);
 
@@ -813,7 +811,7 @@ computeFaceProperties(const Intersection& intersection,
 template<class Grid, class GridView, class ElementMapper, class Scalar>
 std::tuple<std::vector<NNCdata>, std::vector<NNCdata>>
 EclTransmissibility<Grid,GridView,ElementMapper,Scalar>::
-applyNncToGridTrans_(const std::vector<int>& cartesianToCompressed)
+applyNncToGridTrans_(const CartesianToLocalMap& cartesianToCompressed)
 {
     // First scale NNCs with EDITNNC.
     std::vector<NNCdata> unprocessedNnc;
@@ -863,7 +861,7 @@ applyNncToGridTrans_(const std::vector<int>& cartesianToCompressed)
 
 template<class Grid, class GridView, class ElementMapper, class Scalar>
 void EclTransmissibility<Grid,GridView,ElementMapper,Scalar>::
-applyEditNncToGridTrans_(const std::vector<int>& globalToLocal)
+applyEditNncToGridTrans_(const CartesianToLocalMap& globalToLocal)
 {
     const auto& nnc_input = eclState_.getInputNNC();
     const auto& editNnc = nnc_input.edit();
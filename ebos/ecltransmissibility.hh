@@ -29,6 +29,7 @@
 #define EWOMS_ECL_TRANSMISSIBILITY_HH
 
 #include <opm/grid/common/CartesianIndexMapper.hpp>
+#include <opm/simulators/utils/CartesianToLocalMap.hpp>
 
 #include <dune/common/fvector.hh>
 #include <dune/common/fmatrix.hh>
@@ -187,17 +188,17 @@ protected:
      * specified transmissibilities (scaled by EDITNNC) will be added to the already
      * existing models.
      *
-     * \param cartesianToCompressed Vector containing the compressed index (or -1 for inactive
-     *                              cells) as the element at the cartesian index.
+     * \param cartesianToCompressed Map from the cartesian index to the compressed index (or -1
+     *                              for inactive cells).
      * \return Two vector of NNCs (scaled by EDITNNC). The first one are the NNCs that have been applied
      *         and the second the NNCs not resembled by faces of the grid. NNCs specified for
      *         inactive cells are omitted in these vectors.
      */
     std::tuple<std::vector<NNCdata>, std::vector<NNCdata>>
-    applyNncToGridTrans_(const std::vector<int>& cartesianToCompressed);
+    applyNncToGridTrans_(const CartesianToLocalMap& cartesianToCompressed);
 
     /// \brief Multiplies the grid transmissibilities according to EDITNNC.
-    void applyEditNncToGridTrans_(const std::vector<int>& globalToLocal);
+    void applyEditNncToGridTrans_(const CartesianToLocalMap& globalToLocal);
 
     void extractPermeability_();
 
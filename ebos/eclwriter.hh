@@ -39,6 +39,8 @@
 #include <opm/models/io/baseoutputwriter.hh>
 #include <opm/models/parallel/tasklets.hh>
 
+#include <dune/common/timer.hh>
+
 #include <opm/output/eclipse/EclipseIO.hpp>
 
 #include <opm/output/eclipse/RestartValue.hpp>
@@ -51,14 +53,16 @@
 
 #include <opm/simulators/utils/ParallelRestart.hpp>
 #include <opm/grid/GridHelpers.hpp>
-#include <opm/grid/utility/cartesianToCompressed.hpp>
 
 #include <opm/material/common/Valgrind.hpp>
 #include <opm/common/OpmLog/OpmLog.hpp>
 
+#include <algorithm>
 #include <list>
+#include <numeric>
 #include <utility>
 #include <string>
+#include <tuple>
 #include <chrono>
 
 #ifdef HAVE_MPI
@@ -96,17 +100,17 @@ class EclOutputBlackOilModule;
  * I.e. have the same i and j index and all cartesian cells between them
  * along the vertical column are inactive.
  *
- * \tparam CM The type of the cartesian index mapper.
- * \param cartMapper The mapper onto cartesian indices.
- * \param cartesianToActive The mapping of cartesian indices to active indices.
+ * \tparam IsActive The type of the predicate for active cells.
+ * \param cartDims The dimensions of the cartesian grid.
+ * \param isActive Returns whether the cell with a given cartesian index is active.
  * \param smallGlobalIndex The cartesian cell index of the cell with smaller index
  * \param largeGlobalIndex The cartesian cell index of the cell with larger index
  * \return True if the cells have the same i and j indices and all cartesian cells
  *         between them are inactive.
  */
-inline
+template <class IsActive>
 bool directVerticalNeighbors(const std::array<int, 3>& cartDims,
-                             const std::unordered_map<int,int>& cartesianToActive,
+                             const IsActive& isActive,
                              int smallGlobalIndex, int largeGlobalIndex)
 {
     assert(smallGlobalIndex <= largeGlobalIndex);
@@ -129,7 +133,7 @@ bool directVerticalNeighbors(const std::array<int, 3>& cartDims,
         for ( int gi = smallGlobalIndex + cartDims[0] * cartDims[1]; gi < largeGlobalIndex;
               gi += cartDims[0] * cartDims[1] )
         {
-            if ( cartesianToActive.find( gi ) != cartesianToActive.end() )
+            if ( isActive( gi ) )
             {
                 return false;
             }
@@ -238,6 +242,13 @@ public:
         return *eclIO_;
     }
 
+    /*!
+     * \brief Returns the accumulated wall time spent writing the production,
+     *        injection and cumulative report tables to the log.
+     */
+    double logOutputTime() const
+    { return logOutputTimer_.elapsed(); }
+
     const EquilGrid& globalGrid() const
     {
         return simulator_.vanguard().equilGrid();
@@ -245,13 +256,25 @@ public:
 
     void writeInit()
     {
+        // every process contributes the faces of its part of the grid
+        const auto faceTrans = gatherFaceTransmissibilities_();
+
         if (collectToIORank_.isIORank()) {
             std::map<std::string, std::vector<int> > integerVectors;
             if (collectToIORank_.isParallel())
                 integerVectors.emplace("MPI_RANK", collectToIORank_.globalRanks());
-            auto cartMap = cartesianToCompressed(globalGrid().size(0),
-                                                 UgGridHelpers::globalCell(globalGrid()));
-            eclIO_->writeInitial(computeTrans_(cartMap), integerVectors, exportNncStructure_(cartMap));
+
+            // the cartesian indices of the active cells are sorted
+            const int numCells = globalGrid().size(0);
+            const int* globalCell = UgGridHelpers::globalCell(globalGrid());
+            auto isActive = [numCells, globalCell](int cartIdx)
+                            {
+                                if (!globalCell)
+                                    return cartIdx < numCells;
+                                return std::binary_search(globalCell, globalCell + numCells, cartIdx);
+                            };
+            eclIO_->writeInitial(computeTrans_(faceTrans, isActive), integerVectors,
+                                 exportNncStructure_(faceTrans, isActive));
         }
     }
 
@@ -313,9 +336,11 @@ public:
         bool forceDisableProdOutput = false;
         bool forceDisableInjOutput = false;
         bool forceDisableCumOutput = false;
+        logOutputTimer_.start();
         eclOutputModule_->outputProdLog(reportStepNum, isSubStep, forceDisableProdOutput);
         eclOutputModule_->outputInjLog(reportStepNum, isSubStep, forceDisableInjOutput);
         eclOutputModule_->outputCumLog(reportStepNum, isSubStep, forceDisableCumOutput);
+        logOutputTimer_.stop();
 
 
         std::vector<char> buffer;
@@ -507,87 +532,123 @@ private:
     static bool enableEclOutput_()
     { return EWOMS_GET_PARAM(TypeTag, bool, EnableEclOutput); }
 
-    data::Solution computeTrans_(const std::unordered_map<int,int>& cartesianToActive) const
+    //! A face with the position at which a loop over the undistributed grid
+    //! visits it, given by the global element index and intersection index.
+    struct OrderedFace_
     {
-        const auto& cartMapper = simulator_.vanguard().equilCartesianIndexMapper();
-        const auto& cartDims = cartMapper.cartesianDimensions();
-        const int globalSize = cartDims[0]*cartDims[1]*cartDims[2];
+        int elemIdx;
+        int isIdx;
+        NNCdata nnc;
+    };
 
-        data::CellData tranx = {UnitSystem::measure::transmissibility, std::vector<double>(globalSize), data::TargetType::INIT};
-        data::CellData trany = {UnitSystem::measure::transmissibility, std::vector<double>(globalSize), data::TargetType::INIT};
-        data::CellData tranz = {UnitSystem::measure::transmissibility, std::vector<double>(globalSize), data::TargetType::INIT};
+    /*!
+     * \brief Collect the transmissibilities of all faces between active cells
+     *        on the I/O rank.
+     *
+     * Each process handles the faces of its interior cells using its part of
+     * the transmissibilities, and a face is reported by the process which
+     * owns the cell with the smaller global element index. The cells of a
+     * face are given by their cartesian indices with cell1 < cell2. On the
+     * I/O rank the faces are sorted by the global index of the reporting
+     * element and the index of the intersection within it. This is the order
+     * of a loop over the undistributed grid, so the NNC list in the INIT file
+     * is the same as in a sequential run. The result is empty on all
+     * processes except the I/O rank.
+     */
+    std::vector<NNCdata> gatherFaceTransmissibilities_() const
+    {
+        const auto& gridView = simulator_.vanguard().gridView();
+        const auto& cartMapper = simulator_.vanguard().cartesianIndexMapper();
+        const auto& trans = simulator_.problem().eclTransmissibilities();
+        Dune::MultipleCodimMultipleGeomTypeMapper<GridView> elemMapper(gridView, Dune::mcmgElementLayout());
+
+        std::vector<OrderedFace_> localFaces;
+        for (const auto& elem : elements(gridView, Dune::Partitions::interior)) {
+            int isIdx = 0;
+            for (const auto& is : intersections(gridView, elem)) {
+                const int faceIdx = isIdx++;
+                if (!is.neighbor())
+                    continue; // intersection is on the domain boundary
 
-        for (size_t i = 0; i < tranx.data.size(); ++i) {
-            tranx.data[0] = 0.0;
-            trany.data[0] = 0.0;
-            tranz.data[0] = 0.0;
-        }
+                const unsigned c1 = elemMapper.index(is.inside());
+                const unsigned c2 = elemMapper.index(is.outside());
+                const int g1 = collectToIORank_.localIdxToGlobalIdx(c1);
+                const int g2 = collectToIORank_.localIdxToGlobalIdx(c2);
 
-        typedef typename EquilGrid :: LeafGridView  GlobalGridView;
-        const GlobalGridView& globalGridView = globalGrid().leafGridView();
-        typedef Dune::MultipleCodimMultipleGeomTypeMapper<GlobalGridView> ElementMapper;
-        ElementMapper globalElemMapper(globalGridView, Dune::mcmgElementLayout());
+                if (g1 > g2)
+                    continue; // handled from the other cell, possibly by another process
 
-        using TransmissibilityType = typename Vanguard::TransmissibilityType;
+                std::size_t cc1 = cartMapper.cartesianIndex(c1);
+                std::size_t cc2 = cartMapper.cartesianIndex(c2);
+                if (cc2 < cc1)
+                    std::swap(cc1, cc2);
 
-        const TransmissibilityType* globalTrans;
+                localFaces.push_back({g1, faceIdx, NNCdata(cc1, cc2, trans.transmissibility(c1, c2))});
+            }
+        }
 
-        if (!collectToIORank_.isParallel())
-        {
-            // in the sequential case we must use the transmissibilites defined by
-            // the problem. (because in the sequential case, the grid manager does
-            // not compute "global" transmissibilities for performance reasons. in
-            // the parallel case, the problem's transmissibilities can't be used
-            // because this object refers to the distributed grid and we need the
-            // sequential version here.)
-            globalTrans = &simulator_.problem().eclTransmissibilities();
+        std::vector<OrderedFace_> globalFaces;
+        if (!collectToIORank_.isParallel()) {
+            // the faces already are in the order of the element loop
+            globalFaces = std::move(localFaces);
         }
-        else
-        {
-            globalTrans = &(simulator_.vanguard().globalTransmissibility());
+        else {
+            const auto& comm = gridView.comm();
+            int size = localFaces.size();
+            std::vector<int> sizes;
+            std::vector<int> displ;
+            if (collectToIORank_.isIORank())
+                sizes.resize(comm.size());
+            comm.gather(&size, sizes.data(), 1, collectToIORank_.ioRank);
+
+            if (collectToIORank_.isIORank()) {
+                displ.resize(comm.size() + 1, 0);
+                std::partial_sum(sizes.begin(), sizes.end(), displ.begin() + 1);
+                globalFaces.resize(displ.back());
+            }
+            comm.gatherv(localFaces.data(), size, globalFaces.data(),
+                         sizes.data(), displ.data(), collectToIORank_.ioRank);
+            std::sort(globalFaces.begin(), globalFaces.end(),
+                      [](const OrderedFace_& a, const OrderedFace_& b)
+                      {
+                          return std::tie(a.elemIdx, a.isIdx) < std::tie(b.elemIdx, b.isIdx);
+                      });
         }
 
-        auto elemIt = globalGridView.template begin</*codim=*/0>();
-        const auto& elemEndIt = globalGridView.template end</*codim=*/0>();
-        for (; elemIt != elemEndIt; ++ elemIt) {
-            const auto& elem = *elemIt;
-
-            auto isIt = globalGridView.ibegin(elem);
-            const auto& isEndIt = globalGridView.iend(elem);
-            for (; isIt != isEndIt; ++ isIt) {
-                const auto& is = *isIt;
-
-                if (!is.neighbor())
-                    continue; // intersection is on the domain boundary
-
-                unsigned c1 = globalElemMapper.index(is.inside());
-                unsigned c2 = globalElemMapper.index(is.outside());
+        std::vector<NNCdata> faces;
+        faces.reserve(globalFaces.size());
+        for (const auto& face : globalFaces)
+            faces.push_back(face.nnc);
+        return faces;
+    }
 
-                if (c1 > c2)
-                    continue; // we only need to handle each connection once, thank you.
+    template <class IsActive>
+    data::Solution computeTrans_(const std::vector<NNCdata>& faceTrans, const IsActive& isActive) const
+    {
+        const auto& cartDims = simulator_.vanguard().cartesianIndexMapper().cartesianDimensions();
+        const int globalSize = cartDims[0]*cartDims[1]*cartDims[2];
 
-                // Ordering of compressed and uncompressed index should be the same
-                const int cartIdx1 = cartMapper.cartesianIndex( c1 );
-                const int cartIdx2 = cartMapper.cartesianIndex( c2 );
-                // Ordering of compressed and uncompressed index should be the same
-                assert(cartIdx1 <= cartIdx2);
-                int gc1 = std::min(cartIdx1, cartIdx2);
-                int gc2 = std::max(cartIdx1, cartIdx2);
+        data::CellData tranx = {UnitSystem::measure::transmissibility, std::vector<double>(globalSize), data::TargetType::INIT};
+        data::CellData trany = {UnitSystem::measure::transmissibility, std::vector<double>(globalSize), data::TargetType::INIT};
+        data::CellData tranz = {UnitSystem::measure::transmissibility, std::vector<double>(globalSize), data::TargetType::INIT};
 
-                if (gc2 - gc1 == 1 && cartDims[0] > 1 ) {
-                    tranx.data[gc1] = globalTrans->transmissibility(c1, c2);
-                    continue; // skip other if clauses as they are false, last one needs some computation
-                }
+        for (const auto& face : faceTrans) {
+            const int gc1 = face.cell1;
+            const int gc2 = face.cell2;
 
-                if (gc2 - gc1 == cartDims[0] && cartDims[1] > 1) {
-                    trany.data[gc1] = globalTrans->transmissibility(c1, c2);
-                    continue; // skipt next if clause as it needs some computation
-                }
+            if (gc2 - gc1 == 1 && cartDims[0] > 1 ) {
+                tranx.data[gc1] = face.trans;
+                continue; // skip other if clauses as they are false, last one needs some computation
+            }
 
-                if ( gc2 - gc1 == cartDims[0]*cartDims[1] ||
-                     directVerticalNeighbors(cartDims, cartesianToActive, gc1, gc2))
-                    tranz.data[gc1] = globalTrans->transmissibility(c1, c2);
+            if (gc2 - gc1 == cartDims[0] && cartDims[1] > 1) {
+                trany.data[gc1] = face.trans;
+                continue; // skipt next if clause as it needs some computation
             }
+
+            if ( gc2 - gc1 == cartDims[0]*cartDims[1] ||
+                 directVerticalNeighbors(cartDims, isActive, gc1, gc2))
+                tranz.data[gc1] = face.trans;
         }
 
         return {{"TRANX", tranx},
@@ -595,7 +656,8 @@ private:
                 {"TRANZ", tranz}};
     }
 
-    std::vector<NNCdata> exportNncStructure_(const std::unordered_map<int,int>& cartesianToActive) const
+    template <class IsActive>
+    std::vector<NNCdata> exportNncStructure_(const std::vector<NNCdata>& faceTrans, const IsActive& isActive) const
     {
         std::size_t nx = eclState().getInputGrid().getNX();
         std::size_t ny = eclState().getInputGrid().getNY();
@@ -619,78 +681,32 @@ private:
             ++index;
         }
 
-        typedef typename EquilGrid :: LeafGridView  GlobalGridView;
-        const GlobalGridView& globalGridView = globalGrid().leafGridView();
-        typedef Dune::MultipleCodimMultipleGeomTypeMapper<GlobalGridView> ElementMapper;
-        ElementMapper globalElemMapper(globalGridView, Dune::mcmgElementLayout());
-
-        using TransmissibilityType = typename Vanguard::TransmissibilityType;
-        const TransmissibilityType* globalTrans;
-        if (!collectToIORank_.isParallel()) {
-            // in the sequential case we must use the transmissibilites defined by
-            // the problem. (because in the sequential case, the grid manager does
-            // not compute "global" transmissibilities for performance reasons. in
-            // the parallel case, the problem's transmissibilities can't be used
-            // because this object refers to the distributed grid and we need the
-            // sequential version here.)
-            globalTrans = &simulator_.problem().eclTransmissibilities();
-        }
-        else
-        {
-            globalTrans = &(simulator_.vanguard().globalTransmissibility());
-        }
-
-        // Cartesian index mapper for the serial I/O grid
-        const auto& equilCartMapper =  simulator_.vanguard().equilCartesianIndexMapper();
         const auto& cartDims = simulator_.vanguard().cartesianIndexMapper().cartesianDimensions();
-        auto elemIt = globalGridView.template begin</*codim=*/0>();
-        const auto& elemEndIt = globalGridView.template end</*codim=*/0>();
-        for (; elemIt != elemEndIt; ++ elemIt) {
-            const auto& elem = *elemIt;
-
-            auto isIt = globalGridView.ibegin(elem);
-            const auto& isEndIt = globalGridView.iend(elem);
-            for (; isIt != isEndIt; ++ isIt) {
-                const auto& is = *isIt;
-
-                if (!is.neighbor())
-                    continue; // intersection is on the domain boundary
-
-                unsigned c1 = globalElemMapper.index(is.inside());
-                unsigned c2 = globalElemMapper.index(is.outside());
-
-                if (c1 > c2)
-                    continue; // we only need to handle each connection once, thank you.
-
-                std::size_t cc1 = equilCartMapper.cartesianIndex( c1 ); //globalIOGrid_.globalCell()[c1];
-                std::size_t cc2 = equilCartMapper.cartesianIndex( c2 ); //globalIOGrid_.globalCell()[c2];
-
-                if ( cc2 < cc1 )
-                    std::swap(cc1, cc2);
-
-                auto cellDiff = cc2 - cc1;
-
-                if (cellDiff != 1 &&
-                    cellDiff != nx &&
-                    cellDiff != nx*ny &&
-                    ! directVerticalNeighbors(cartDims, cartesianToActive, cc1, cc2)) {
-                    // We need to check whether an NNC for this face was also specified
-                    // via the NNC keyword in the deck (i.e. in the first origNncSize entries.
-                    auto t = globalTrans->transmissibility(c1, c2);
-                    auto candidate = std::lower_bound(nncData.begin(), nncData.end(), NNCdata(cc1, cc2, 0.0));
-
-                    while ( candidate != nncData.end() && candidate->cell1 == cc1
-                         && candidate->cell2 == cc2) {
-                        t -= candidate->trans;
-                        ++candidate;
-                    }
-                    // eclipse ignores NNCs with zero transmissibility (different threshold than for NNC
-                    // with corresponding EDITNNC above). In addition we do set small transmissibilties
-                    // to zero when setting up the simulator. These will be ignored here, too.
-                    auto tt = unitSystem.from_si(UnitSystem::measure::transmissibility, std::abs(t));
-                    if ( tt > 1e-12 )
-                        outputNnc.push_back({cc1, cc2, t});
+        for (const auto& face : faceTrans) {
+            const std::size_t cc1 = face.cell1;
+            const std::size_t cc2 = face.cell2;
+            auto cellDiff = cc2 - cc1;
+
+            if (cellDiff != 1 &&
+                cellDiff != nx &&
+                cellDiff != nx*ny &&
+                ! directVerticalNeighbors(cartDims, isActive, cc1, cc2)) {
+                // We need to check whether an NNC for this face was also specified
+                // via the NNC keyword in the deck (i.e. in the first origNncSize entries.
+                auto t = face.trans;
+                auto candidate = std::lower_bound(nncData.begin(), nncData.end(), NNCdata(cc1, cc2, 0.0));
+
+                while ( candidate != nncData.end() && candidate->cell1 == cc1
+                     && candidate->cell2 == cc2) {
+                    t -= candidate->trans;
+                    ++candidate;
                 }
+                // eclipse ignores NNCs with zero transmissibility (different threshold than for NNC
+                // with corresponding EDITNNC above). In addition we do set small transmissibilties
+                // to zero when setting up the simulator. These will be ignored here, too.
+                auto tt = unitSystem.from_si(UnitSystem::measure::transmissibility, std::abs(t));
+                if ( tt > 1e-12 )
+                    outputNnc.push_back({cc1, cc2, t});
             }
         }
         return outputNnc;
@@ -835,6 +851,7 @@ private:
     std::unique_ptr<EclOutputBlackOilModule<TypeTag>> eclOutputModule_;
     std::unique_ptr<EclipseIO> eclIO_;
     std::unique_ptr<TaskletRunner> taskletRunner_;
+    Dune::Timer logOutputTimer_{false};
     Scalar restartTimeStepSize_;
 };
 } // namespace Opm
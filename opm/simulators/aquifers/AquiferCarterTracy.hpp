@@ -28,6 +28,7 @@
 #include <exception>
 #include <memory>
 #include <stdexcept>
+#include <tuple>
 #include <utility>
 
 namespace Opm
@@ -101,6 +102,18 @@ protected:
     Scalar dimensionless_time_{0};
     Scalar dimensionless_pressure_{0};
 
+    // The influence table values only depend on the time level and the
+    // time step size, not on the connection.  They are evaluated once per
+    // (time, dt) pair and shared by all connections of the aquifer.
+    struct InfluenceTableValues
+    {
+        Scalar time{-1.0};
+        Scalar dt{-1.0};
+        Scalar PItd{0};
+        Scalar PItdprime{0};
+    };
+    InfluenceTableValues influence_table_values_{};
+
     void assignRestartData(const data::AquiferData& /* xaq */) override
     {
         throw std::runtime_error {"Restart-based initialization not currently supported "
@@ -135,14 +148,30 @@ protected:
         return dp;
     }
 
+    const InfluenceTableValues&
+    influenceTableValues(const Simulator& simulator)
+    {
+        auto& values = this->influence_table_values_;
+        if ((values.time != simulator.time()) || (values.dt != simulator.timeStepSize())) {
+            values.time = simulator.time();
+            values.dt = simulator.timeStepSize();
+
+            const Scalar td_plus_dt = (values.dt + values.time) / this->Tc_;
+            this->dimensionless_time_ = values.time / this->Tc_;
+
+            std::tie(values.PItd, values.PItdprime) = this->getInfluenceTableValues(td_plus_dt);
+        }
+
+        return values;
+    }
+
     // This function implements Eqs 5.8 and 5.9 of the EclipseTechnicalDescription
     std::pair<Scalar, Scalar>
     calculateEqnConstants(const int idx, const Simulator& simulator)
     {
-        const Scalar td_plus_dt = (simulator.timeStepSize() + simulator.time()) / this->Tc_;
-        this->dimensionless_time_ = simulator.time() / this->Tc_;
-
-        const auto [PItd, PItdprime] = this->getInfluenceTableValues(td_plus_dt);
+        const auto& influence = this->influenceTableValues(simulator);
+        const auto PItd = influence.PItd;
+        const auto PItdprime = influence.PItdprime;
 
         const auto denom = this->Tc_ * (PItd - this->dimensionless_time_*PItdprime);
         const auto a = (this->beta_*dpai(idx) - this->fluxValue_*PItdprime) / denom;
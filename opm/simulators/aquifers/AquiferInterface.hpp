@@ -51,6 +51,8 @@ public:
     using RateVector = GetPropType<TypeTag, Properties::RateVector>;
     using IntensiveQuantities = GetPropType<TypeTag, Properties::IntensiveQuantities>;
     using ElementMapper = GetPropType<TypeTag, Properties::ElementMapper>;
+    using GridView = GetPropType<TypeTag, Properties::GridView>;
+    using ElementSeed = typename GridView::template Codim<0>::Entity::EntitySeed;
 
     enum { enableTemperature = getPropValue<TypeTag, Properties::EnableTemperature>() };
     enum { enableEnergy = getPropValue<TypeTag, Properties::EnableEnergy>() };
@@ -112,10 +114,9 @@ public:
     void beginTimeStep()
     {
         ElementContext elemCtx(ebos_simulator_);
-        auto elemIt = ebos_simulator_.gridView().template begin<0>();
-        const auto& elemEndIt = ebos_simulator_.gridView().template end<0>();
-        for (; elemIt != elemEndIt; ++elemIt) {
-            const auto& elem = *elemIt;
+        const auto& grid = ebos_simulator_.vanguard().grid();
+        for (const auto& seed : this->connected_elements_) {
+            const auto elem = grid.entity(seed);
 
             elemCtx.updatePrimaryStencil(elem);
 
@@ -216,6 +217,8 @@ protected:
     // Grid variables
     std::vector<Scalar> faceArea_connected_;
     std::vector<int> cellToConnectionIdx_;
+    // Interior elements of this process connected to the aquifer
+    std::vector<ElementSeed> connected_elements_;
 
     // Quantities at each grid id
     std::vector<Scalar> cell_depth_;
@@ -244,6 +247,7 @@ protected:
         // denom_face_areas is the sum of the areas connected to an aquifer
         Scalar denom_face_areas = 0.;
         this->cellToConnectionIdx_.resize(this->ebos_simulator_.gridView().size(/*codim=*/0), -1);
+        this->connected_elements_.clear();
         const auto& gridView = this->ebos_simulator_.vanguard().gridView();
         for (size_t idx = 0; idx < this->size(); ++idx) {
             const auto global_index = this->connections_[idx].global_index;
@@ -272,6 +276,8 @@ protected:
             if( idx < 0)
                 continue;
 
+            this->connected_elements_.push_back(elem.seed());
+
             auto isIt = gridView.ibegin(elem);
             const auto& isEndIt = gridView.iend(elem);
             for (; isIt != isEndIt; ++ isIt) {
@@ -24,6 +24,12 @@
 #include <opm/output/data/Aquifer.hpp>
 #include <opm/parser/eclipse/EclipseState/Aquifer/NumericalAquifer/SingleNumericalAquifer.hpp>
 
+#include <dune/grid/common/partitionset.hh>
+#include <dune/grid/common/rangegenerators.hh>
+
+#include <optional>
+#include <vector>
+
 namespace Opm
 {
 template <typename TypeTag>
@@ -38,6 +44,9 @@ public:
     using GridView = GetPropType<TypeTag, Properties::GridView>;
     using MaterialLaw = GetPropType<TypeTag, Properties::MaterialLaw>;
 
+    using Element = typename GridView::template Codim<0>::Entity;
+    using ElementSeed = typename Element::EntitySeed;
+
     enum { dimWorld = GridView::dimensionworld };
 
     static const auto waterPhaseIdx = FluidSystem::waterPhaseIdx;
@@ -70,6 +79,8 @@ public:
                 this->cell_to_aquifer_cell_idx_[cell_idx] = idx;
             }
         }
+
+        this->collectInteriorAquiferCells();
     }
 
     void initFromRestart([[maybe_unused]]const std::vector<data::AquiferData>& aquiferSoln)
@@ -121,28 +132,41 @@ private:
     // TODO: maybe unordered_map can also do the work to save memory?
     std::vector<int> cell_to_aquifer_cell_idx_;
 
-    double calculateAquiferPressure() const
-    {
-        double sum_pressure_watervolume = 0.;
-        double sum_watervolume = 0.;
+    // Seeds of the interior elements of this process which are aquifer
+    // cells, so that the end of time step calculations do not need to
+    // traverse the whole grid.
+    std::vector<ElementSeed> interior_aquifer_cells_;
+    // Seed of the first aquifer cell, the one connecting to the
+    // reservoir, if it is an interior element of this process.
+    std::optional<ElementSeed> first_aquifer_cell_;
 
-        ElementContext  elem_ctx(this->ebos_simulator_);
+    void collectInteriorAquiferCells()
+    {
         const auto& gridView = this->ebos_simulator_.gridView();
-        auto elemIt = gridView.template begin</*codim=*/0>();
-        const auto& elemEndIt = gridView.template end</*codim=*/0>();
-        for (; elemIt != elemEndIt; ++elemIt) {
-            const auto& elem = *elemIt;
-            if (elem.partitionType() != Dune::InteriorEntity) {
+        const auto& elemMapper = this->ebos_simulator_.model().elementMapper();
+        for (const auto& elem : elements(gridView, Dune::Partitions::interior)) {
+            const int idx = this->cell_to_aquifer_cell_idx_[elemMapper.index(elem)];
+            if (idx < 0) {
                 continue;
             }
-            elem_ctx.updatePrimaryStencil(elem);
 
-            const size_t cell_index = elem_ctx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
-            const int idx = this->cell_to_aquifer_cell_idx_[cell_index];
-            if (idx < 0) {
-                continue;
+            this->interior_aquifer_cells_.push_back(elem.seed());
+            if (idx == 0) {
+                this->first_aquifer_cell_ = elem.seed();
             }
+        }
+    }
 
+    double calculateAquiferPressure() const
+    {
+        double sum_pressure_watervolume = 0.;
+        double sum_watervolume = 0.;
+
+        ElementContext  elem_ctx(this->ebos_simulator_);
+        const auto& grid = this->ebos_simulator_.vanguard().grid();
+        for (const auto& seed : this->interior_aquifer_cells_) {
+            const auto elem = grid.entity(seed);
+            elem_ctx.updatePrimaryStencil(elem);
             elem_ctx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
             const auto& iq0 = elem_ctx.intensiveQuantities(/*spaceIdx=*/0, /*timeIdx=*/0);
             const auto& fs = iq0.fluidState();
@@ -170,60 +194,45 @@ private:
     {
         double aquifer_flux = 0.;
 
-        ElementContext  elem_ctx(this->ebos_simulator_);
-        const auto& gridView = this->ebos_simulator_.gridView();
-        auto elemIt = gridView.template begin</*codim=*/0>();
-        const auto& elemEndIt = gridView.template end</*codim=*/0>();
-        for (; elemIt != elemEndIt; ++elemIt) {
-            const auto &elem = *elemIt;
-            if (elem.partitionType() != Dune::InteriorEntity) {
-                continue;
-            }
-            // elem_ctx.updatePrimaryStencil(elem);
-            elem_ctx.updateStencil(elem);
+        // we only need the first aquifer cell
+        if (!this->first_aquifer_cell_.has_value()) {
+            return aquifer_flux;
+        }
 
-            const size_t cell_index = elem_ctx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
-            const int idx = this->cell_to_aquifer_cell_idx_[cell_index];
-            // we only need the first aquifer cell
-            if (idx != 0) {
+        ElementContext  elem_ctx(this->ebos_simulator_);
+        const auto elem = this->ebos_simulator_.vanguard().grid().entity(*this->first_aquifer_cell_);
+        // elem_ctx.updatePrimaryStencil(elem);
+        elem_ctx.updateStencil(elem);
+        elem_ctx.updateAllIntensiveQuantities();
+        elem_ctx.updateAllExtensiveQuantities();
+
+        const size_t num_interior_faces = elem_ctx.numInteriorFaces(/*timeIdx*/ 0);
+        // const auto &problem = elem_ctx.problem();
+        const auto &stencil = elem_ctx.stencil(0);
+        // const auto& inQuants = elem_ctx.intensiveQuantities(0, /*timeIdx*/ 0);
+
+        for (size_t face_idx = 0; face_idx < num_interior_faces; ++face_idx) {
+            const auto &face = stencil.interiorFace(face_idx);
+            // dof index
+            const size_t i = face.interiorIndex();
+            const size_t j = face.exteriorIndex();
+            // compressed index
+            // const size_t I = stencil.globalSpaceIndex(i);
+            const size_t J = stencil.globalSpaceIndex(j);
+
+            // we do not consider the flux within aquifer cells
+            // we only need the flux to the connections
+            if (this->cell_to_aquifer_cell_idx_[J] > 0) {
                 continue;
             }
-            elem_ctx.updateAllIntensiveQuantities();
-            elem_ctx.updateAllExtensiveQuantities();
-
-            const size_t num_interior_faces = elem_ctx.numInteriorFaces(/*timeIdx*/ 0);
-            // const auto &problem = elem_ctx.problem();
-            const auto &stencil = elem_ctx.stencil(0);
-            // const auto& inQuants = elem_ctx.intensiveQuantities(0, /*timeIdx*/ 0);
-
-            for (size_t face_idx = 0; face_idx < num_interior_faces; ++face_idx) {
-                const auto &face = stencil.interiorFace(face_idx);
-                // dof index
-                const size_t i = face.interiorIndex();
-                const size_t j = face.exteriorIndex();
-                // compressed index
-                // const size_t I = stencil.globalSpaceIndex(i);
-                const size_t J = stencil.globalSpaceIndex(j);
-
-                assert(stencil.globalSpaceIndex(i) == cell_index);
-
-                // we do not consider the flux within aquifer cells
-                // we only need the flux to the connections
-                if (this->cell_to_aquifer_cell_idx_[J] > 0) {
-                    continue;
-                }
-                const auto &exQuants = elem_ctx.extensiveQuantities(face_idx, /*timeIdx*/ 0);
-                const double water_flux = Toolbox::value(exQuants.volumeFlux(waterPhaseIdx));
-
-                const size_t up_id = water_flux >= 0. ? i : j;
-                const auto &intQuantsIn = elem_ctx.intensiveQuantities(up_id, 0);
-                const double invB = Toolbox::value(intQuantsIn.fluidState().invB(waterPhaseIdx));
-                const double face_area = face.area();
-                aquifer_flux += water_flux * invB * face_area;
-            }
-
-            // we only need to handle the first aquifer cell, we can exit loop here
-            break;
+            const auto &exQuants = elem_ctx.extensiveQuantities(face_idx, /*timeIdx*/ 0);
+            const double water_flux = Toolbox::value(exQuants.volumeFlux(waterPhaseIdx));
+
+            const size_t up_id = water_flux >= 0. ? i : j;
+            const auto &intQuantsIn = elem_ctx.intensiveQuantities(up_id, 0);
+            const double invB = Toolbox::value(intQuantsIn.fluidState().invB(waterPhaseIdx));
+            const double face_area = face.area();
+            aquifer_flux += water_flux * invB * face_area;
         }
 
         return aquifer_flux;
@@ -211,6 +211,7 @@ namespace Opm {
         , well_model_ (well_model)
         , terminal_output_ (terminal_output)
         , current_relaxation_(1.0)
+        , forcing_term_(param_.max_linear_solver_reduction_)
         , dx_old_(UgGridHelpers::numCells(grid_))
         {
             // compute global sum of number of cells
@@ -247,6 +248,8 @@ namespace Opm {
             ebosSimulator_.model().newtonMethod().setIterationIndex(0);
 
             ebosSimulator_.problem().beginTimeStep();
+            // the reset of the well and group states to the last committed ones
+            report.well_state_copy_time += wellModel().takeWGStateCopyTime();
 
             unsigned numDof = ebosSimulator_.model().numGridDof();
             wasSwitched_.resize(numDof);
@@ -287,6 +290,7 @@ namespace Opm {
                 residual_norms_history_.clear();
                 current_relaxation_ = 1.0;
                 dx_old_ = 0.0;
+                check_last_update_ = false;
                 convergence_reports_.push_back({timer.reportStepNum(), timer.currentStepNum(), {}});
                 convergence_reports_.back().report.reserve(11);
             }
@@ -305,12 +309,39 @@ namespace Opm {
             }
 
             std::vector<double> residual_norms;
+            bool onlyWellsFailed = false;
             perfTimer.reset();
             perfTimer.start();
             // the step is not considered converged until at least minIter iterations is done
             {
                 auto convrep = getConvergence(timer, iteration,residual_norms);
+
+                // Shorten the last update while it does not reduce the residual enough.
+                while (lineSearchRejectsLastUpdate(residual_norms)) {
+                    report.update_time += perfTimer.stop();
+                    perfTimer.reset();
+                    perfTimer.start();
+                    backtrackLastUpdate();
+                    report.total_linearizations += 1;
+                    try {
+                        report += assembleReservoir(timer, iteration);
+                        report.assemble_time += perfTimer.stop();
+                    }
+                    catch (...) {
+                        report.assemble_time += perfTimer.stop();
+                        failureReport_ += report;
+                        throw;
+                    }
+                    perfTimer.reset();
+                    perfTimer.start();
+                    residual_norms.clear();
+                    convrep = getConvergence(timer, iteration, residual_norms);
+                }
+                check_last_update_ = false;
+                last_merit_ = lineSearchMerit(residual_norms);
+
                 report.converged = convrep.converged()  && iteration > nonlinear_solver.minIter();;
+                onlyWellsFailed = convrep.wellFailed() && !convrep.reservoirFailed();
                 ConvergenceReport::Severity severity = convrep.severityOfWorstFailure();
                 convergence_reports_.back().report.push_back(std::move(convrep));
 
@@ -323,6 +354,23 @@ namespace Opm {
             }
             report.update_time += perfTimer.stop();
             residual_norms_history_.push_back(residual_norms);
+            if (!report.converged && onlyWellsFailed && param_.use_well_only_iterations_) {
+                // The reservoir is converged, so iterate the wells against the
+                // current reservoir state and skip the linear solve. The next
+                // iteration checks whether the reservoir is still converged with
+                // the new well rates, and does a full iteration if not.
+                perfTimer.reset();
+                perfTimer.start();
+                const bool wellsConverged = wellModel().solveWellEquationsWithFrozenReservoir();
+                report.update_time += perfTimer.stop();
+                if (wellsConverged) {
+                    if (terminalOutputEnabled()) {
+                        OpmLog::debug("    Well equations solved with the reservoir state kept fixed");
+                    }
+                    report.total_newton_iterations = 1;
+                    return report;
+                }
+            }
             if (!report.converged) {
                 perfTimer.reset();
                 perfTimer.start();
@@ -382,6 +430,16 @@ namespace Opm {
                     nonlinear_solver.stabilizeNonlinearUpdate(x, dx_old_, current_relaxation_);
                 }
 
+                // Keep what is needed to shorten the update if the line search
+                // rejects it in the next iteration.
+                if (param_.use_line_search_) {
+                    solution_before_update_ = ebosSimulator_.model().solution(/*timeIdx=*/0);
+                    last_update_ = x;
+                    line_search_step_ = 1.0;
+                    line_search_backtracks_ = 0;
+                    check_last_update_ = true;
+                }
+
                 // Apply the update, with considering model-dependent limitations and
                 // chopping of the update.
                 updateSolution(x);
@@ -407,8 +465,15 @@ namespace Opm {
             SimulatorReportSingle report;
             Dune::Timer perfTimer;
             perfTimer.start();
+            const double logOutputTimeBefore = ebosSimulator_.problem().logOutputTime();
             ebosSimulator_.problem().endTimeStep();
-            report.pre_post_time += perfTimer.stop();
+            // the commit of the well and group states of the finished step
+            report.well_state_copy_time += wellModel().takeWGStateCopyTime();
+            // The report tables are written to the log from endTimeStep();
+            // account for them as output rather than post-processing.
+            const double logOutputTime = ebosSimulator_.problem().logOutputTime() - logOutputTimeBefore;
+            report.pre_post_time += perfTimer.stop() - logOutputTime;
+            report.output_write_time += logOutputTime;
             return report;
         }
 
@@ -425,7 +490,10 @@ namespace Opm {
             ebosSimulator_.model().linearizer().linearizeDomain();
             ebosSimulator_.problem().endIteration();
 
-            return wellModel().lastReport();
+            // the NUPCOL snapshots taken while assembling the well equations
+            SimulatorReportSingle report = wellModel().lastReport();
+            report.well_state_copy_time += wellModel().takeWGStateCopyTime();
+            return report;
         }
 
         // compute the "relative" change of the solution between time steps
@@ -535,6 +603,9 @@ namespace Opm {
             perfTimer.start();
             ebosSolver.prepare(ebosJac, ebosResid);
             linear_solve_setup_time_ = perfTimer.stop();
+            if (param_.use_inexact_newton_) {
+                ebosSolver.setResidualReduction(linearSolverForcingTerm());
+            }
             ebosSolver.setResidual(ebosResid);
             // actually, the error needs to be calculated after setResidual in order to
             // account for parallelization properly. since the residual of ECFV
@@ -546,6 +617,36 @@ namespace Opm {
 
 
 
+        /// Relative residual reduction for the next linear solve, chosen
+        /// from the CNV norms of the last two Newton iterations as in
+        /// choice 2 of Eisenstat and Walker (1996), and bounded by
+        /// MaxLinearSolverReduction.
+        double linearSolverForcingTerm()
+        {
+            const double eta_max = param_.max_linear_solver_reduction_;
+            const auto& history = residual_norms_history_;
+            auto maxNorm = [](const std::vector<double>& norms)
+            {
+                return norms.empty() ? 0.0 : *std::max_element(norms.begin(), norms.end());
+            };
+            const double previous = history.size() < 2 ? 0.0 : maxNorm(history[history.size() - 2]);
+            if (previous <= 0.0) {
+                forcing_term_ = eta_max;
+                return forcing_term_;
+            }
+
+            const double gamma = 0.9;
+            const double alpha = 2.0;
+            double eta = gamma * std::pow(maxNorm(history.back()) / previous, alpha);
+            // Do not let the tolerance drop much faster than the residual.
+            const double safeguard = gamma * std::pow(forcing_term_, alpha);
+            if (safeguard > 0.1) {
+                eta = std::max(eta, safeguard);
+            }
+            forcing_term_ = std::min(eta, eta_max);
+            return forcing_term_;
+        }
+
         /// Apply an update to the primary variables.
         void updateSolution(const BVector& dx)
         {
@@ -563,6 +664,45 @@ namespace Opm {
             ebosSimulator_.model().invalidateAndUpdateIntensiveQuantities(/*timeIdx=*/0);
         }
 
+        /// The merit function of the line search: the Euclidean norm of
+        /// the scaled (CNV) residuals of the components.
+        static double lineSearchMerit(const std::vector<double>& residual_norms)
+        {
+            double sum = 0.0;
+            for (const double r : residual_norms) {
+                sum += r * r;
+            }
+            return std::sqrt(sum);
+        }
+
+        /// Return true if the last update does not satisfy the Armijo
+        /// condition and may still be shortened. For a Newton update the
+        /// condition reads |F(u + s dx)| <= (1 - c s) |F(u)|.
+        bool lineSearchRejectsLastUpdate(const std::vector<double>& residual_norms) const
+        {
+            if (!check_last_update_ || line_search_backtracks_ >= param_.max_line_search_backtracks_) {
+                return false;
+            }
+            constexpr double c = 1e-4;
+            // Written to also reject NaN residuals.
+            return !(lineSearchMerit(residual_norms) <= (1.0 - c * line_search_step_) * last_merit_);
+        }
+
+        /// Replace the last update by one of half its length.
+        void backtrackLastUpdate()
+        {
+            line_search_step_ *= 0.5;
+            ++line_search_backtracks_;
+            ebosSimulator_.model().solution(/*timeIdx=*/0) = solution_before_update_;
+            BVector dx(last_update_);
+            dx *= line_search_step_;
+            updateSolution(dx);
+            if (terminalOutputEnabled()) {
+                OpmLog::debug("    Line search: update shortened to "
+                              + std::to_string(line_search_step_) + " of its length");
+            }
+        }
+
         /// Return true if output to cout is wanted.
         bool terminalOutputEnabled() const
         {
@@ -995,8 +1135,17 @@ namespace Opm {
 
         std::vector<std::vector<double>> residual_norms_history_;
         double current_relaxation_;
+        double forcing_term_;
         BVector dx_old_;
 
+        // State of the line search over the last update.
+        SolutionVector solution_before_update_;
+        BVector last_update_;
+        double last_merit_ = 0.0;
+        double line_search_step_ = 1.0;
+        int line_search_backtracks_ = 0;
+        bool check_last_update_ = false;
+
         std::vector<StepReport> convergence_reports_;
     public:
         /// return the StandardWells object
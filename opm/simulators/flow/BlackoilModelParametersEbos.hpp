@@ -100,6 +100,26 @@ struct UseUpdateStabilization {
     using type = UndefinedProperty;
 };
 template<class TypeTag, class MyTypeTag>
+struct UseInexactNewton {
+    using type = UndefinedProperty;
+};
+template<class TypeTag, class MyTypeTag>
+struct MaxLinearSolverReduction {
+    using type = UndefinedProperty;
+};
+template<class TypeTag, class MyTypeTag>
+struct UseWellOnlyIterations {
+    using type = UndefinedProperty;
+};
+template<class TypeTag, class MyTypeTag>
+struct UseLineSearch {
+    using type = UndefinedProperty;
+};
+template<class TypeTag, class MyTypeTag>
+struct MaxLineSearchBacktracks {
+    using type = UndefinedProperty;
+};
+template<class TypeTag, class MyTypeTag>
 struct MatrixAddWellContributions {
     using type = UndefinedProperty;
 };
@@ -229,6 +249,27 @@ struct UseUpdateStabilization<TypeTag, TTag::FlowModelParameters> {
     static constexpr bool value = true;
 };
 template<class TypeTag>
+struct UseInexactNewton<TypeTag, TTag::FlowModelParameters> {
+    static constexpr bool value = false;
+};
+template<class TypeTag>
+struct MaxLinearSolverReduction<TypeTag, TTag::FlowModelParameters> {
+    using type = GetPropType<TypeTag, Scalar>;
+    static constexpr type value = 0.1;
+};
+template<class TypeTag>
+struct UseWellOnlyIterations<TypeTag, TTag::FlowModelParameters> {
+    static constexpr bool value = false;
+};
+template<class TypeTag>
+struct UseLineSearch<TypeTag, TTag::FlowModelParameters> {
+    static constexpr bool value = false;
+};
+template<class TypeTag>
+struct MaxLineSearchBacktracks<TypeTag, TTag::FlowModelParameters> {
+    static constexpr int value = 3;
+};
+template<class TypeTag>
 struct MatrixAddWellContributions<TypeTag, TTag::FlowModelParameters> {
     static constexpr bool value = false;
 };
@@ -374,6 +415,23 @@ namespace Opm
         /// Try to detect oscillation or stagnation.
         bool use_update_stabilization_;
 
+        /// Adapt the linear solver tolerance to the progress of the Newton method.
+        bool use_inexact_newton_;
+
+        /// Loosest relative residual reduction asked of the linear solver
+        /// when use_inexact_newton_ is set.
+        double max_linear_solver_reduction_;
+
+        /// Only solve the well equations, and skip the linear solve of the
+        /// full system, in iterations where only the wells are not converged.
+        bool use_well_only_iterations_;
+
+        /// Halve a Newton update while it does not reduce the residual enough.
+        bool use_line_search_;
+
+        /// Maximum number of step halvings of a single Newton update.
+        int max_line_search_backtracks_;
+
         /// Whether to use MultisegmentWell to handle multisegment wells
         /// it is something temporary before the multisegment well model is considered to be
         /// well developed and tested.
@@ -416,6 +474,11 @@ namespace Opm
             solve_welleq_initially_ = EWOMS_GET_PARAM(TypeTag, bool, SolveWelleqInitially);
             update_equations_scaling_ = EWOMS_GET_PARAM(TypeTag, bool, UpdateEquationsScaling);
             use_update_stabilization_ = EWOMS_GET_PARAM(TypeTag, bool, UseUpdateStabilization);
+            use_inexact_newton_ = EWOMS_GET_PARAM(TypeTag, bool, UseInexactNewton);
+            max_linear_solver_reduction_ = EWOMS_GET_PARAM(TypeTag, Scalar, MaxLinearSolverReduction);
+            use_well_only_iterations_ = EWOMS_GET_PARAM(TypeTag, bool, UseWellOnlyIterations);
+            use_line_search_ = EWOMS_GET_PARAM(TypeTag, bool, UseLineSearch);
+            max_line_search_backtracks_ = EWOMS_GET_PARAM(TypeTag, int, MaxLineSearchBacktracks);
             matrix_add_well_contributions_ = EWOMS_GET_PARAM(TypeTag, bool, MatrixAddWellContributions);
 
             deck_file_name_ = EWOMS_GET_PARAM(TypeTag, std::string, EclDeckFileName);
@@ -451,6 +514,11 @@ namespace Opm
             EWOMS_REGISTER_PARAM(TypeTag, bool, SolveWelleqInitially, "Fully solve the well equations before each iteration of the reservoir model");
             EWOMS_REGISTER_PARAM(TypeTag, bool, UpdateEquationsScaling, "Update scaling factors for mass balance equations during the run");
             EWOMS_REGISTER_PARAM(TypeTag, bool, UseUpdateStabilization, "Try to detect and correct oscillations or stagnation during the Newton method");
+            EWOMS_REGISTER_PARAM(TypeTag, bool, UseInexactNewton, "Choose the linear solver tolerance from the reduction of the nonlinear residual (Eisenstat-Walker)");
+            EWOMS_REGISTER_PARAM(TypeTag, Scalar, MaxLinearSolverReduction, "Loosest relative residual reduction of the linear solver used by the inexact Newton method");
+            EWOMS_REGISTER_PARAM(TypeTag, bool, UseWellOnlyIterations, "Solve only the well equations with the reservoir state kept fixed in Newton iterations where the reservoir is converged but some wells are not");
+            EWOMS_REGISTER_PARAM(TypeTag, bool, UseLineSearch, "Shorten Newton updates by backtracking until the scaled reservoir residual satisfies the Armijo condition");
+            EWOMS_REGISTER_PARAM(TypeTag, int, MaxLineSearchBacktracks, "Maximum number of times a Newton update is halved by the line search");
             EWOMS_REGISTER_PARAM(TypeTag, bool, MatrixAddWellContributions, "Explicitly specify the influences of wells between cells in the Jacobian and preconditioner matrices");
             EWOMS_REGISTER_PARAM(TypeTag, bool, EnableWellOperabilityCheck, "Enable the well operability checking");
         }
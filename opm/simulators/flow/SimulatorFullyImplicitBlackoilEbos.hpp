@@ -32,6 +32,9 @@
 #include <opm/grid/utility/StopWatch.hpp>
 
 #include <opm/common/ErrorMacros.hpp>
+#include <opm/common/utility/FileSystem.hpp>
+
+#include <fstream>
 
 namespace Opm::Properties {
 
@@ -43,6 +46,10 @@ template<class TypeTag, class MyTypeTag>
 struct EnableTuning {
     using type = UndefinedProperty;
 };
+template<class TypeTag, class MyTypeTag>
+struct EnableReportStepTimings {
+    using type = UndefinedProperty;
+};
 
 template<class TypeTag>
 struct EnableTerminalOutput<TypeTag, TTag::EclFlowProblem> {
@@ -56,6 +63,10 @@ template<class TypeTag>
 struct EnableTuning<TypeTag, TTag::EclFlowProblem> {
     static constexpr bool value = false;
 };
+template<class TypeTag>
+struct EnableReportStepTimings<TypeTag, TTag::EclFlowProblem> {
+    static constexpr bool value = true;
+};
 
 } // namespace Opm::Properties
 
@@ -119,6 +130,8 @@ public:
         const auto& comm = grid().comm();
         terminalOutput_ = EWOMS_GET_PARAM(TypeTag, bool, EnableTerminalOutput);
         terminalOutput_ = terminalOutput_ && (comm.rank() == 0);
+        reportStepTimings_ = EWOMS_GET_PARAM(TypeTag, bool, EnableReportStepTimings);
+        reportStepTimings_ = reportStepTimings_ && (comm.rank() == 0);
     }
 
     static void registerParameters()
@@ -133,6 +146,8 @@ public:
                              "Use adaptive time stepping between report steps");
         EWOMS_REGISTER_PARAM(TypeTag, bool, EnableTuning,
                              "Honor some aspects of the TUNING keyword.");
+        EWOMS_REGISTER_PARAM(TypeTag, bool, EnableReportStepTimings,
+                             "Write the timings and iteration counts of each report step to <CASE>.INFOREP as CSV");
     }
 
     /// Run the simulation.
@@ -180,6 +195,14 @@ public:
                 adaptiveTimeStepping_->setSuggestedNextStep(ebosSimulator_.timeStepSize());
             }
         }
+
+        if (reportStepTimings_) {
+            const auto& ioConfig = eclState().getIOConfig();
+            namespace fs = ::Opm::filesystem;
+            const fs::path fullpath = fs::path(ioConfig.getOutputDir()) / (ioConfig.getBaseName() + ".INFOREP");
+            reportStepTimingsFile_.open(fullpath.string());
+            SimulatorReport::reportStepCsvHeader(reportStepTimingsFile_);
+        }
     }
 
     bool runStep(SimulatorTimer& timer)
@@ -192,6 +215,9 @@ public:
             return false;
         }
 
+        // Work done in this report step, added to report_ at the end.
+        SimulatorReport stepTotals;
+
         // Report timestep.
         if (terminalOutput_) {
             std::ostringstream ss;
@@ -223,7 +249,7 @@ public:
             wellModel_().beginReportStep(timer.currentStepNum());
             ebosSimulator_.problem().writeOutput();
 
-            report_.success.output_write_time += perfTimer.stop();
+            stepTotals.success.output_write_time += perfTimer.stop();
         }
 
         // Run a multiple steps of the solver depending on the time step control.
@@ -256,11 +282,11 @@ public:
                 events.hasEvent(ScheduleEvents::WELL_SWITCHED_INJECTOR_PRODUCER) ||
                 events.hasEvent(ScheduleEvents::WELL_STATUS_CHANGE);
             auto stepReport = adaptiveTimeStepping_->step(timer, *solver, event, nullptr);
-            report_ += stepReport;
+            stepTotals += stepReport;
         } else {
             // solve for complete report step
             auto stepReport = solver->step(timer);
-            report_ += stepReport;
+            stepTotals += stepReport;
             if (terminalOutput_) {
                 std::ostringstream ss;
                 stepReport.reportStep(ss);
@@ -274,7 +300,7 @@ public:
         const double nextstep = adaptiveTimeStepping_ ? adaptiveTimeStepping_->suggestedNextStep() : -1.0;
         ebosSimulator_.problem().setNextTimeStepSize(nextstep);
         ebosSimulator_.problem().writeOutput();
-        report_.success.output_write_time += perfTimer.stop();
+        stepTotals.success.output_write_time += perfTimer.stop();
 
         solver->model().endReportStep();
 
@@ -282,7 +308,15 @@ public:
         solverTimer_->stop();
 
         // update timing.
-        report_.success.solver_time += solverTimer_->secsSinceStart();
+        stepTotals.success.solver_time += solverTimer_->secsSinceStart();
+
+        if (reportStepTimings_) {
+            stepTotals.reportStepCsv(reportStepTimingsFile_, timer.currentStepNum(),
+                                     timer.simulationTimeElapsed() + timer.currentStepLength(),
+                                     timer.currentStepLength());
+            reportStepTimingsFile_.flush();
+        }
+        report_ += stepTotals;
 
         // Increment timer, remember well state.
         ++timer;
@@ -381,6 +415,8 @@ protected:
     PhaseUsage phaseUsage_;
     // Misc. data
     bool terminalOutput_;
+    bool reportStepTimings_;
+    std::ofstream reportStepTimingsFile_;
 
     SimulatorReport report_;
     std::unique_ptr<time::StopWatch> solverTimer_;
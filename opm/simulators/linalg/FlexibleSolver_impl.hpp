@@ -23,6 +23,7 @@
 
 #include <opm/simulators/linalg/FlexibleSolver.hpp>
 #include <opm/simulators/linalg/PreconditionerFactory.hpp>
+#include <opm/simulators/linalg/RecyclingGCRSolver.hpp>
 #include <opm/simulators/linalg/matrixblock.hh>
 
 #include <dune/common/fmatrix.hh>
@@ -168,6 +169,17 @@ namespace Dune
                                                                         restart, // desired residual reduction factor
                                                                         maxiter, // maximum number of iterations
                                                                         verbosity));
+        } else if (solver_type == "recyclinggcr") {
+            int restart = prm.get<int>("restart", 15);
+            int recycle = prm.get<int>("recycle", 5);
+            linsolver_.reset(new Dune::RecyclingGCRSolver<VectorType>(*linearoperator_for_solver_,
+                                                                      *scalarproduct_,
+                                                                      *preconditioner_,
+                                                                      tol, // desired residual reduction factor
+                                                                      restart,
+                                                                      recycle, // number of directions kept between solves
+                                                                      maxiter, // maximum number of iterations
+                                                                      verbosity));
 #if HAVE_SUITESPARSE_UMFPACK
         } else if (solver_type == "umfpack") {
             bool dummy = false;
@@ -82,6 +82,10 @@ struct IluReorderSpheres {
     using type = UndefinedProperty;
 };
 template<class TypeTag, class MyTypeTag>
+struct IluReorderRcm {
+    using type = UndefinedProperty;
+};
+template<class TypeTag, class MyTypeTag>
 struct UseGmres {
     using type = UndefinedProperty;
 };
@@ -114,10 +118,18 @@ struct CprReuseSetup {
     using type = UndefinedProperty;
 };
 template<class TypeTag, class MyTypeTag>
+struct CprDirectCoarseMaxSize {
+    using type = UndefinedProperty;
+};
+template<class TypeTag, class MyTypeTag>
 struct Linsolver {
     using type = UndefinedProperty;
 };
 template<class TypeTag, class MyTypeTag>
+struct LinearSolverFallback {
+    using type = UndefinedProperty;
+};
+template<class TypeTag, class MyTypeTag>
 struct AcceleratorMode {
     using type = UndefinedProperty;
 };
@@ -177,6 +189,10 @@ struct IluReorderSpheres<TypeTag, TTag::FlowIstlSolverParams> {
     static constexpr bool value = false;
 };
 template<class TypeTag>
+struct IluReorderRcm<TypeTag, TTag::FlowIstlSolverParams> {
+    static constexpr bool value = false;
+};
+template<class TypeTag>
 struct UseGmres<TypeTag, TTag::FlowIstlSolverParams> {
     static constexpr bool value = false;
 };
@@ -213,10 +229,18 @@ struct CprReuseSetup<TypeTag, TTag::FlowIstlSolverParams> {
     static constexpr int value = 3;
 };
 template<class TypeTag>
+struct CprDirectCoarseMaxSize<TypeTag, TTag::FlowIstlSolverParams> {
+    static constexpr int value = 0;
+};
+template<class TypeTag>
 struct Linsolver<TypeTag, TTag::FlowIstlSolverParams> {
     static constexpr auto value = "ilu0";
 };
 template<class TypeTag>
+struct LinearSolverFallback<TypeTag, TTag::FlowIstlSolverParams> {
+    static constexpr auto value = "";
+};
+template<class TypeTag>
 struct AcceleratorMode<TypeTag, TTag::FlowIstlSolverParams> {
     static constexpr auto value = "none";
 };
@@ -255,16 +279,19 @@ namespace Opm
         MILU_VARIANT   ilu_milu_;
         bool   ilu_redblack_;
         bool   ilu_reorder_sphere_;
+        bool   ilu_reorder_rcm_;
         bool   newton_use_gmres_;
         bool   require_full_sparsity_pattern_;
         bool   ignoreConvergenceFailure_;
         bool scale_linear_system_;
         std::string linsolver_;
+        std::string linear_solver_fallback_;
         std::string accelerator_mode_;
         int bda_device_id_;
         int opencl_platform_id_;
         int cpr_max_ell_iter_ = 20;
         int cpr_reuse_setup_ = 0;
+        int cpr_direct_coarse_max_size_ = 0;
         std::string opencl_ilu_reorder_;
         std::string fpga_bitstream_;
 
@@ -281,13 +308,16 @@ namespace Opm
             ilu_milu_ = convertString2Milu(EWOMS_GET_PARAM(TypeTag, std::string, MiluVariant));
             ilu_redblack_ = EWOMS_GET_PARAM(TypeTag, bool, IluRedblack);
             ilu_reorder_sphere_ = EWOMS_GET_PARAM(TypeTag, bool, IluReorderSpheres);
+            ilu_reorder_rcm_ = EWOMS_GET_PARAM(TypeTag, bool, IluReorderRcm);
             newton_use_gmres_ = EWOMS_GET_PARAM(TypeTag, bool, UseGmres);
             require_full_sparsity_pattern_ = EWOMS_GET_PARAM(TypeTag, bool, LinearSolverRequireFullSparsityPattern);
             ignoreConvergenceFailure_ = EWOMS_GET_PARAM(TypeTag, bool, LinearSolverIgnoreConvergenceFailure);
             scale_linear_system_ = EWOMS_GET_PARAM(TypeTag, bool, ScaleLinearSystem);
             cpr_max_ell_iter_  =  EWOMS_GET_PARAM(TypeTag, int, CprMaxEllIter);
             cpr_reuse_setup_  =  EWOMS_GET_PARAM(TypeTag, int, CprReuseSetup);
+            cpr_direct_coarse_max_size_ = EWOMS_GET_PARAM(TypeTag, int, CprDirectCoarseMaxSize);
             linsolver_ = EWOMS_GET_PARAM(TypeTag, std::string, Linsolver);
+            linear_solver_fallback_ = EWOMS_GET_PARAM(TypeTag, std::string, LinearSolverFallback);
             accelerator_mode_ = EWOMS_GET_PARAM(TypeTag, std::string, AcceleratorMode);
             bda_device_id_ = EWOMS_GET_PARAM(TypeTag, int, BdaDeviceId);
             opencl_platform_id_ = EWOMS_GET_PARAM(TypeTag, int, OpenclPlatformId);
@@ -307,13 +337,16 @@ namespace Opm
             EWOMS_REGISTER_PARAM(TypeTag, std::string, MiluVariant, "Specify which variant of the modified-ILU preconditioner ought to be used. Possible variants are: ILU (default, plain ILU), MILU_1 (lump diagonal with dropped row entries), MILU_2 (lump diagonal with the sum of the absolute values of the dropped row  entries), MILU_3 (if diagonal is positive add sum of dropped row entrires. Otherwise substract them), MILU_4 (if diagonal is positive add sum of dropped row entrires. Otherwise do nothing");
             EWOMS_REGISTER_PARAM(TypeTag, bool, IluRedblack, "Use red-black partioning for the ILU preconditioner");
             EWOMS_REGISTER_PARAM(TypeTag, bool, IluReorderSpheres, "Whether to reorder the entries of the matrix in the red-black ILU preconditioner in spheres starting at an edge. If false the original ordering is preserved in each color. Otherwise why try to ensure D4 ordering (in a 2D structured grid, the diagonal elements are consecutive).");
+            EWOMS_REGISTER_PARAM(TypeTag, bool, IluReorderRcm, "Factorize the matrix of the ILU preconditioner in reverse Cuthill-McKee ordering of the cells to reduce its bandwidth and improve memory locality");
             EWOMS_REGISTER_PARAM(TypeTag, bool, UseGmres, "Use GMRES as the linear solver");
             EWOMS_REGISTER_PARAM(TypeTag, bool, LinearSolverRequireFullSparsityPattern, "Produce the full sparsity pattern for the linear solver");
             EWOMS_REGISTER_PARAM(TypeTag, bool, LinearSolverIgnoreConvergenceFailure, "Continue with the simulation like nothing happened after the linear solver did not converge");
             EWOMS_REGISTER_PARAM(TypeTag, bool, ScaleLinearSystem, "Scale linear system according to equation scale and primary variable types");
             EWOMS_REGISTER_PARAM(TypeTag, int, CprMaxEllIter, "MaxIterations of the elliptic pressure part of the cpr solver");
+            EWOMS_REGISTER_PARAM(TypeTag, int, CprDirectCoarseMaxSize, "Solve the pressure system of the cpr solver with a sparse direct factorisation instead of AMG if it has at most this many rows. Only used in sequential runs and if UMFPack is available. 0 (default) disables the direct solver");
             EWOMS_REGISTER_PARAM(TypeTag, int, CprReuseSetup, "Reuse preconditioner setup. Valid options are 0: recreate the preconditioner for every linear solve, 1: recreate once every timestep, 2: recreate if last linear solve took more than 10 iterations, 3: never recreate");
             EWOMS_REGISTER_PARAM(TypeTag, std::string, Linsolver, "Configuration of solver. Valid options are: ilu0 (default), cpr (an alias for cpr_trueimpes), cpr_quasiimpes, cpr_trueimpes or amg. Alternatively, you can request a configuration to be read from a JSON file by giving the filename here, ending with '.json.'");
+            EWOMS_REGISTER_PARAM(TypeTag, std::string, LinearSolverFallback, "Comma separated list of solver configurations that are tried in order on the same linear system before a convergence failure is reported. Valid stages are gmres (GMRES with four times the restart length), cpr (CPR with a fresh setup), ilu (ILU with one more fill-in level) and maxiter (five times the iteration limit). Default is no fallback");
             EWOMS_REGISTER_PARAM(TypeTag, std::string, AcceleratorMode, "Use GPU (cusparseSolver or openclSolver) or FPGA (fpgaSolver) as the linear solver, usage: '--accelerator-mode=[none|cusparse|opencl|fpga]'");
             EWOMS_REGISTER_PARAM(TypeTag, int, BdaDeviceId, "Choose device ID for cusparseSolver or openclSolver, use 'nvidia-smi' or 'clinfo' to determine valid IDs");
             EWOMS_REGISTER_PARAM(TypeTag, int, OpenclPlatformId, "Choose platform ID for openclSolver, use 'clinfo' to determine valid platform IDs");
@@ -338,6 +371,7 @@ namespace Opm
             ilu_milu_                 = MILU_VARIANT::ILU;
             ilu_redblack_             = false;
             ilu_reorder_sphere_       = true;
+            ilu_reorder_rcm_          = false;
             accelerator_mode_         = "none";
             bda_device_id_            = 0;
             opencl_platform_id_       = 0;
@@ -34,6 +34,10 @@
 #include <opm/simulators/linalg/getQuasiImpesWeights.hpp>
 #include <opm/simulators/linalg/setupPropertyTree.hpp>
 
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
 
 #if HAVE_CUDA || HAVE_OPENCL || HAVE_FPGA
 #include <opm/simulators/linalg/bda/BdaBridge.hpp>
@@ -118,6 +122,8 @@ namespace Opm
             : simulator_(simulator),
               iterations_( 0 ),
               converged_(false),
+              residualReduction_(0.0),
+              startReduction_(1.0),
               matrix_()
         {
             const bool on_io_rank = (simulator.gridView().comm().rank() == 0);
@@ -126,14 +132,23 @@ namespace Opm
 #endif
             parameters_.template init<TypeTag>();
             prm_ = setupPropertyTree<TypeTag>(parameters_);
+            fallbacks_ = setupFallbackChain(parameters_.linear_solver_fallback_, prm_, parameters_);
 #if HAVE_CUDA || HAVE_OPENCL || HAVE_FPGA
             {
                 std::string accelerator_mode = EWOMS_GET_PARAM(TypeTag, std::string, AcceleratorMode);
                 if ((simulator_.vanguard().grid().comm().size() > 1) && (accelerator_mode != "none")) {
-                    if (on_io_rank) {
-                        OpmLog::warning("Cannot use GPU or FPGA with MPI, GPU/FPGA are disabled");
+                    // With MPI each process solves its own part of the system on the
+                    // accelerator, decoupled from the other processes (block-Jacobi), and
+                    // the distributed Dune solver corrects that solution. The process-local
+                    // systems need to contain the well contributions for this.
+                    if (!EWOMS_GET_PARAM(TypeTag, bool, MatrixAddWellContributions)) {
+                        if (on_io_rank) {
+                            OpmLog::warning("Using GPU or FPGA with MPI needs --matrix-add-well-contributions=true, GPU/FPGA are disabled");
+                        }
+                        accelerator_mode = "none";
+                    } else if (on_io_rank) {
+                        OpmLog::info("Using GPU or FPGA with MPI: the process-local solutions are used as initial guess for the parallel linear solver");
                     }
-                    accelerator_mode = "none";
                 }
                 const int platformID = EWOMS_GET_PARAM(TypeTag, int, OpenclPlatformId);
                 const int deviceID = EWOMS_GET_PARAM(TypeTag, int, BdaDeviceId);
@@ -175,6 +190,18 @@ namespace Opm
 
             interiorCellNum_ = detail::numMatrixRowsToUseInSolver(simulator_.vanguard().grid(), true);
 
+            if (isParallel() && prm_.get<std::string>("preconditioner.type") == "ParOverILU0") {
+                // CPR needs the overlap rows to be invalidated in prepare(),
+                // which is not done if the primary solver uses ILU.
+                const auto isCpr = [](const auto& fallback) { return fallback.first == "cpr"; };
+                if (std::any_of(fallbacks_.begin(), fallbacks_.end(), isCpr)) {
+                    if (on_io_rank) {
+                        OpmLog::warning("The cpr stage of --linear-solver-fallback is ignored in parallel runs using ILU");
+                    }
+                    fallbacks_.erase(std::remove_if(fallbacks_.begin(), fallbacks_.end(), isCpr), fallbacks_.end());
+                }
+            }
+
             // Print parameters to PRT/DBG logs.
             if (on_io_rank) {
                 std::ostringstream os;
@@ -250,6 +277,7 @@ namespace Opm
             // Solve system.
             Dune::InverseOperatorResult result;
             bool accelerator_was_used = false;
+            startReduction_ = 1.0;
 
             // Use GPU if: available, chosen by user, and successful.
             // Use FPGA if: support compiled, chosen by user, and successful.
@@ -270,7 +298,29 @@ namespace Opm
                 if (result.converged) {
                     // get result vector x from non-Dune backend, iff solve was successful
                     bdaBridge->get_result(x);
-                    accelerator_was_used = true;
+                    if (isParallel()) {
+                        // The accelerator only solved the system of this process. Make
+                        // the solution consistent and let the parallel solver below
+                        // resolve the coupling between the processes starting from it,
+                        // unless it already meets the tolerance of the global system.
+#if HAVE_MPI
+                        comm_->copyOwnerToAll(x, x);
+                        Vector residual = *rhs_;
+                        getMatrix().mmv(x, residual);
+                        const double rhsNorm = comm_->norm(*rhs_);
+                        if (rhsNorm > 0.0) {
+                            startReduction_ = comm_->norm(residual) / rhsNorm;
+                        }
+                        if (startReduction_ >= 1.0) {
+                            // no better than starting from zero
+                            x = 0.0;
+                            startReduction_ = 1.0;
+                        }
+                        accelerator_was_used = startReduction_ <= targetReduction(prm_);
+#endif
+                    } else {
+                        accelerator_was_used = true;
+                    }
                 } else {
                     // warn about CPU fallback
                     // BdaBridge might have disabled its BdaSolver for this simulation due to some error
@@ -286,7 +336,15 @@ namespace Opm
             // Otherwise, use flexible istl solver.
             if (!accelerator_was_used) {
                 assert(flexibleSolver_);
-                flexibleSolver_->apply(x, *rhs_, result);
+                if (!fallbacks_.empty()) {
+                    // The solver overwrites the right hand side and the initial guess.
+                    rhsCopy_ = *rhs_;
+                    xCopy_ = x;
+                }
+                applyFlexibleSolver(*flexibleSolver_, prm_, x, result);
+                if (!result.converged && !fallbacks_.empty()) {
+                    solveWithFallbacks(x, result);
+                }
             }
 
             // Check convergence, iterations etc.
@@ -305,6 +363,12 @@ namespace Opm
         /// \copydoc NewtonIterationBlackoilInterface::iterations
         int iterations () const { return iterations_; }
 
+        /// Set the relative residual reduction of the following solves, e.g.
+        /// the forcing term of an inexact Newton method. It is never tighter
+        /// than the configured tolerance, and a non-positive value restores
+        /// that tolerance.
+        void setResidualReduction(double reduction) { residualReduction_ = reduction; }
+
         /// \copydoc NewtonIterationBlackoilInterface::parallelInformation
         const std::any& parallelInformation() const { return parallelInformation_; }
 
@@ -348,35 +412,29 @@ namespace Opm
 
         void prepareFlexibleSolver()
         {
-
-            std::function<Vector()> weightsCalculator = getWeightsCalculator();
-
             if (shouldCreateSolver()) {
                 if (isParallel()) {
 #if HAVE_MPI
                     if (useWellConn_) {
                         using ParOperatorType = Dune::OverlappingSchwarzOperator<Matrix, Vector, Vector, Comm>;
                         linearOperatorForFlexibleSolver_ = std::make_unique<ParOperatorType>(getMatrix(), *comm_);
-                        flexibleSolver_ = std::make_unique<FlexibleSolverType>(*linearOperatorForFlexibleSolver_, *comm_, prm_, weightsCalculator);
                     } else {
                         using ParOperatorType = WellModelGhostLastMatrixAdapter<Matrix, Vector, Vector, true>;
                         wellOperator_ = std::make_unique<WellModelOperator>(simulator_.problem().wellModel());
                         linearOperatorForFlexibleSolver_ = std::make_unique<ParOperatorType>(getMatrix(), *wellOperator_, interiorCellNum_);
-                        flexibleSolver_ = std::make_unique<FlexibleSolverType>(*linearOperatorForFlexibleSolver_, *comm_, prm_, weightsCalculator);
                     }
 #endif
                 } else {
                     if (useWellConn_) {
                         using SeqOperatorType = Dune::MatrixAdapter<Matrix, Vector, Vector>;
                         linearOperatorForFlexibleSolver_ = std::make_unique<SeqOperatorType>(getMatrix());
-                        flexibleSolver_ = std::make_unique<FlexibleSolverType>(*linearOperatorForFlexibleSolver_, prm_, weightsCalculator);
                     } else {
                         using SeqOperatorType = WellModelMatrixAdapter<Matrix, Vector, Vector, false>;
                         wellOperator_ = std::make_unique<WellModelOperator>(simulator_.problem().wellModel());
                         linearOperatorForFlexibleSolver_ = std::make_unique<SeqOperatorType>(getMatrix(), *wellOperator_);
-                        flexibleSolver_ = std::make_unique<FlexibleSolverType>(*linearOperatorForFlexibleSolver_, prm_, weightsCalculator);
                     }
                 }
+                flexibleSolver_ = createFlexibleSolver(prm_);
             }
             else
             {
@@ -385,6 +443,72 @@ namespace Opm
         }
 
 
+        /// Create a solver for the current linear operator.
+        std::unique_ptr<FlexibleSolverType> createFlexibleSolver(const boost::property_tree::ptree& prm)
+        {
+            std::function<Vector()> weightsCalculator = getWeightsCalculator(prm);
+#if HAVE_MPI
+            if (isParallel()) {
+                return std::make_unique<FlexibleSolverType>(*linearOperatorForFlexibleSolver_, *comm_, prm, weightsCalculator);
+            }
+#endif
+            return std::make_unique<FlexibleSolverType>(*linearOperatorForFlexibleSolver_, prm, weightsCalculator);
+        }
+
+
+        /// Reduction of the initial residual ||b|| requested from the solver
+        /// with the given parameters.
+        double targetReduction(const boost::property_tree::ptree& prm) const
+        {
+            const double tol = prm.get<double>("tol", 1e-2);
+            return residualReduction_ > 0.0 ? std::max(residualReduction_, tol) : tol;
+        }
+
+        /// Apply the solver starting from x. The Dune solvers reduce the
+        /// residual of their starting point, so when x already reduced ||b||
+        /// by startReduction_ the remaining reduction is relaxed accordingly,
+        /// which makes the target relative to ||b|| in any case.
+        void applyFlexibleSolver(FlexibleSolverType& solver,
+                                 const boost::property_tree::ptree& prm,
+                                 Vector& x,
+                                 Dune::InverseOperatorResult& result)
+        {
+            if (startReduction_ < 1.0) {
+                solver.apply(x, *rhs_, targetReduction(prm) / startReduction_, result);
+            } else if (residualReduction_ > 0.0) {
+                solver.apply(x, *rhs_, targetReduction(prm), result);
+            } else {
+                solver.apply(x, *rhs_, result);
+            }
+        }
+
+
+        /// Retry the last linear system with the configured fallback
+        /// solvers until one of them converges. The iterations of all
+        /// attempts are accumulated in result.
+        void solveWithFallbacks(Vector& x, Dune::InverseOperatorResult& result)
+        {
+            const bool on_io_rank = (simulator_.gridView().comm().rank() == 0);
+            int iterations = result.iterations;
+            for (const auto& [name, prm] : fallbacks_) {
+                auto solver = createFlexibleSolver(prm);
+                x = xCopy_;
+                *rhs_ = rhsCopy_;
+                applyFlexibleSolver(*solver, prm, x, result);
+                iterations += result.iterations;
+                if (on_io_rank) {
+                    OpmLog::debug("Linear solver fallback '" + name + "' "
+                                  + (result.converged ? "converged" : "did not converge")
+                                  + " in " + std::to_string(result.iterations) + " iterations");
+                }
+                if (result.converged) {
+                    break;
+                }
+            }
+            result.iterations = iterations;
+        }
+
+
         /// Return true if we should (re)create the whole solver,
         /// instead of just calling update() on the preconditioner.
         bool shouldCreateSolver() const
@@ -416,15 +540,15 @@ namespace Opm
 
 
         /// Return an appropriate weight function if a cpr preconditioner is asked for.
-        std::function<Vector()> getWeightsCalculator() const
+        std::function<Vector()> getWeightsCalculator(const boost::property_tree::ptree& prm) const
         {
             std::function<Vector()> weightsCalculator;
 
-            auto preconditionerType = prm_.get("preconditioner.type", "cpr");
+            auto preconditionerType = prm.get("preconditioner.type", "cpr");
             if (preconditionerType == "cpr" || preconditionerType == "cprt") {
                 const bool transpose = preconditionerType == "cprt";
-                const auto weightsType = prm_.get("preconditioner.weight_type", "quasiimpes");
-                const auto pressureIndex = this->prm_.get("preconditioner.pressure_var_index", 1);
+                const auto weightsType = prm.get("preconditioner.weight_type", "quasiimpes");
+                const auto pressureIndex = prm.get("preconditioner.pressure_var_index", 1);
                 if (weightsType == "quasiimpes") {
                     // weighs will be created as default in the solver
                     weightsCalculator = [this, transpose, pressureIndex]() {
@@ -450,10 +574,7 @@ namespace Opm
         Vector getTrueImpesWeights(int pressureVarIndex) const
         {
             Vector weights(rhs_->size());
-            ElementContext elemCtx(simulator_);
-            Amg::getTrueImpesWeights(pressureVarIndex, weights, simulator_.vanguard().gridView(),
-                                     elemCtx, simulator_.model(),
-                                     ThreadManager::threadId());
+            Amg::getTrueImpesWeights<Vector, ElementContext, ThreadManager>(pressureVarIndex, weights, simulator_);
             return weights;
         }
 
@@ -494,6 +615,9 @@ namespace Opm
         const Simulator& simulator_;
         mutable int iterations_;
         mutable bool converged_;
+        double residualReduction_;
+        // ||b - A x0|| / ||b|| of the initial guess computed by the accelerator
+        double startReduction_;
         std::any parallelInformation_;
 
         // non-const to be able to scale the linear system
@@ -512,6 +636,9 @@ namespace Opm
 
         FlowLinearSolverParameters parameters_;
         boost::property_tree::ptree prm_;
+        std::vector<std::pair<std::string, boost::property_tree::ptree>> fallbacks_;
+        Vector rhsCopy_;
+        Vector xCopy_;
         bool scale_variables_;
 
         std::shared_ptr< CommunicationType > comm_;
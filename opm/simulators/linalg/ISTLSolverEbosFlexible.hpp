@@ -198,7 +198,12 @@ public:
 
     bool solve(VectorType& x)
     {
-        solver_->apply(x, rhs_, res_);
+        if (residualReduction_ > 0.0) {
+            const double reduction = std::max(residualReduction_, prm_.get<double>("tol", 1e-2));
+            solver_->apply(x, rhs_, reduction, res_);
+        } else {
+            solver_->apply(x, rhs_, res_);
+        }
         this->writeMatrix();
         return res_.converged;
     }
@@ -217,6 +222,15 @@ public:
         return res_.iterations;
     }
 
+    /// Set the relative residual reduction of the following solves, e.g.
+    /// the forcing term of an inexact Newton method. It is never tighter
+    /// than the configured tolerance, and a non-positive value restores
+    /// that tolerance.
+    void setResidualReduction(double reduction)
+    {
+        residualReduction_ = reduction;
+    }
+
     void setResidual(VectorType& /* b */)
     {
         // rhs_ = &b; // Must be handled in prepare() instead.
@@ -311,10 +325,7 @@ protected:
     VectorType getTrueImpesWeights(const VectorType& b, const int pressureVarIndex) const
     {
         VectorType weights(b.size());
-        ElementContext elemCtx(simulator_);
-        Opm::Amg::getTrueImpesWeights(pressureVarIndex, weights, simulator_.vanguard().gridView(),
-                                      elemCtx, simulator_.model(),
-                                      ThreadManager::threadId());
+        Opm::Amg::getTrueImpesWeights<VectorType, ElementContext, ThreadManager>(pressureVarIndex, weights, simulator_);
         return weights;
     }
 
@@ -340,6 +351,7 @@ protected:
     boost::property_tree::ptree prm_;
     VectorType rhs_;
     Dune::InverseOperatorResult res_;
+    double residualReduction_ = 0.0;
     std::any parallelInformation_;
     bool ownersFirst_;
     bool matrixAddWellContributions_;
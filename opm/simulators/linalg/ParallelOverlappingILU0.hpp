@@ -29,8 +29,10 @@
 #include <dune/istl/paamg/graph.hh>
 #include <dune/istl/paamg/pinfo.hh>
 
+#include <algorithm>
 #include <type_traits>
 #include <numeric>
+#include <vector>
 #include <limits>
 #include <cstddef>
 #include <string>
@@ -190,6 +192,60 @@ namespace Opm
         const std::vector<std::size_t>* ordering_;
     };
 
+    /// \brief Compute a reverse Cuthill-McKee ordering of the first
+    /// numRows rows of a matrix, using its sparsity pattern as graph.
+    ///
+    /// Each connected component is traversed breadth first, starting at a
+    /// row of minimal degree and visiting the neighbors by increasing
+    /// degree. The remaining rows, e.g. ghost rows, keep their position.
+    /// \return The new index of each row.
+    template<class M>
+    std::vector<std::size_t> reverseCuthillMcKee(const M& A, std::size_t numRows)
+    {
+        std::vector<std::size_t> degree(numRows);
+        for (std::size_t i = 0; i < numRows; ++i) {
+            degree[i] = A[i].size();
+        }
+        const auto byDegree = [&degree](std::size_t i, std::size_t j)
+                              { return degree[i] < degree[j]; };
+
+        std::vector<std::size_t> starts(numRows);
+        std::iota(starts.begin(), starts.end(), 0);
+        std::stable_sort(starts.begin(), starts.end(), byDegree);
+
+        std::vector<std::size_t> order;
+        order.reserve(numRows);
+        std::vector<bool> visited(numRows, false);
+        std::vector<std::size_t> neighbors;
+        for (const std::size_t start : starts) {
+            if (visited[start]) {
+                continue;
+            }
+            visited[start] = true;
+            order.push_back(start);
+            for (std::size_t head = order.size() - 1; head < order.size(); ++head) {
+                neighbors.clear();
+                const auto& row = A[order[head]];
+                for (auto col = row.begin(); col != row.end(); ++col) {
+                    const std::size_t j = col.index();
+                    if (j < numRows && !visited[j]) {
+                        visited[j] = true;
+                        neighbors.push_back(j);
+                    }
+                }
+                std::stable_sort(neighbors.begin(), neighbors.end(), byDegree);
+                order.insert(order.end(), neighbors.begin(), neighbors.end());
+            }
+        }
+
+        std::vector<std::size_t> ordering(A.N());
+        for (std::size_t k = 0; k < numRows; ++k) {
+            ordering[order[k]] = numRows - 1 - k;
+        }
+        std::iota(ordering.begin() + numRows, ordering.end(), numRows);
+        return ordering;
+    }
+
     struct IdentityFunctor
     {
         template<class T>
@@ -692,19 +748,21 @@ public:
                             The vertices on each layer aound it (same distance) are
                             ordered consecutivly. If false, we preserver the order of
                             the vertices with the same color.
+      \param rcm Whether to use a reverse Cuthill-McKee ordering of the interior
+                 rows. Ignored if redblack is true.
     */
     template<class BlockType, class Alloc>
     ParallelOverlappingILU0 (const Dune::BCRSMatrix<BlockType,Alloc>& A,
                              const int n, const field_type w,
                              MILU_VARIANT milu, bool redblack=false,
-                             bool reorder_sphere=true)
+                             bool reorder_sphere=true, bool rcm=false)
         : lower_(),
           upper_(),
           inv_(),
           comm_(nullptr), w_(w),
           relaxation_( std::abs( w - 1.0 ) > 1e-15 ),
           A_(&reinterpret_cast<const Matrix&>(A)), iluIteration_(n),
-          milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere)
+          milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere), rcm_(rcm)
     {
         interiorSize_ = A.N();
         // BlockMatrix is a Subclass of FieldMatrix that just adds
@@ -723,19 +781,21 @@ public:
                             The vertices on each layer aound it (same distance) are
                             ordered consecutivly. If false, we preserver the order of
                             the vertices with the same color.
+      \param rcm Whether to use a reverse Cuthill-McKee ordering of the interior
+                 rows. Ignored if redblack is true.
     */
     template<class BlockType, class Alloc>
     ParallelOverlappingILU0 (const Dune::BCRSMatrix<BlockType,Alloc>& A,
                              const ParallelInfo& comm, const int n, const field_type w,
                              MILU_VARIANT milu, bool redblack=false,
-                             bool reorder_sphere=true)
+                             bool reorder_sphere=true, bool rcm=false)
         : lower_(),
           upper_(),
           inv_(),
           comm_(&comm), w_(w),
           relaxation_( std::abs( w - 1.0 ) > 1e-15 ),
           A_(&reinterpret_cast<const Matrix&>(A)), iluIteration_(n),
-          milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere)
+          milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere), rcm_(rcm)
     {
         interiorSize_ = A.N();
         // BlockMatrix is a Subclass of FieldMatrix that just adds
@@ -754,12 +814,14 @@ public:
                   The vertices on each layer aound it (same distance) are
                   ordered consecutivly. If false, we preserver the order of
                   the vertices with the same color.
+      \param rcm Whether to use a reverse Cuthill-McKee ordering of the interior
+                 rows. Ignored if redblack is true.
     */
     template<class BlockType, class Alloc>
     ParallelOverlappingILU0 (const Dune::BCRSMatrix<BlockType,Alloc>& A,
                              const field_type w, MILU_VARIANT milu, bool redblack=false,
-                             bool reorder_sphere=true)
-        : ParallelOverlappingILU0( A, 0, w, milu, redblack, reorder_sphere )
+                             bool reorder_sphere=true, bool rcm=false)
+        : ParallelOverlappingILU0( A, 0, w, milu, redblack, reorder_sphere, rcm )
     {
     }
 
@@ -775,19 +837,21 @@ public:
                             The vertices on each layer aound it (same distance) are
                             ordered consecutivly. If false, we preserver the order of
                             the vertices with the same color.
+      \param rcm Whether to use a reverse Cuthill-McKee ordering of the interior
+                 rows. Ignored if redblack is true.
     */
     template<class BlockType, class Alloc>
     ParallelOverlappingILU0 (const Dune::BCRSMatrix<BlockType,Alloc>& A,
                              const ParallelInfo& comm, const field_type w,
                              MILU_VARIANT milu, bool redblack=false,
-                             bool reorder_sphere=true)
+                             bool reorder_sphere=true, bool rcm=false)
         : lower_(),
           upper_(),
           inv_(),
           comm_(&comm), w_(w),
           relaxation_( std::abs( w - 1.0 ) > 1e-15 ),
           A_(&reinterpret_cast<const Matrix&>(A)), iluIteration_(0),
-          milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere)
+          milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere), rcm_(rcm)
     {
         interiorSize_ = A.N();
         // BlockMatrix is a Subclass of FieldMatrix that just adds
@@ -808,13 +872,15 @@ public:
                             The vertices on each layer aound it (same distance) are
                             ordered consecutivly. If false, we preserver the order of
                             the vertices with the same color.
+      \param rcm Whether to use a reverse Cuthill-McKee ordering of the interior
+                 rows. Ignored if redblack is true.
     */
     template<class BlockType, class Alloc>
     ParallelOverlappingILU0 (const Dune::BCRSMatrix<BlockType,Alloc>& A,
                              const ParallelInfo& comm,
                              const field_type w, MILU_VARIANT milu,
                              size_type interiorSize, bool redblack=false,
-                             bool reorder_sphere=true)
+                             bool reorder_sphere=true, bool rcm=false)
         : lower_(),
           upper_(),
           inv_(),
@@ -822,7 +888,7 @@ public:
           relaxation_( std::abs( w - 1.0 ) > 1e-15 ),
           interiorSize_(interiorSize),
           A_(&reinterpret_cast<const Matrix&>(A)), iluIteration_(0),
-          milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere)
+          milu_(milu), redBlack_(redblack), reorderSphere_(reorder_sphere), rcm_(rcm)
     {
         // BlockMatrix is a Subclass of FieldMatrix that just adds
         // methods. Therefore this cast should be safe.
@@ -894,12 +960,13 @@ public:
             inv_[ i ].mv( rhs, vBlock);
         }
 
-        copyOwnerToAll( mv );
-
         if( relaxation_ ) {
             mv *= w_;
         }
         reorderBack(mv, v);
+
+        // The communication uses the original numbering.
+        copyOwnerToAll( v );
     }
 
     template <class V>
@@ -963,6 +1030,12 @@ public:
                                                       graph);
             }
         }
+        else if ( rcm_ && ordering_.empty() )
+        {
+            // The sparsity pattern does not change, so the ordering is
+            // only computed once.
+            ordering_ = detail::reverseCuthillMcKee(*A_, interiorSize_);
+        }
 
         std::vector<std::size_t> inverseOrdering(ordering_.size());
         std::size_t index = 0;
@@ -1143,6 +1216,7 @@ protected:
     MILU_VARIANT milu_;
     bool redBlack_;
     bool reorderSphere_;
+    bool rcm_;
 };
 
 } // end namespace Opm
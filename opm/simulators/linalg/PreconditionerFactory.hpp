@@ -235,14 +235,15 @@ private:
         const double w = prm.get<double>("relaxation", 1.0);
         const bool redblack = prm.get<bool>("redblack", false);
         const bool reorder_spheres = prm.get<bool>("reorder_spheres", false);
+        const bool rcm = prm.get<bool>("rcm", false);
         // Already a parallel preconditioner. Need to pass comm, but no need to wrap it in a BlockPreconditioner.
         if (ilulevel == 0) {
             const size_t num_interior = interiorIfGhostLast(comm);
             return std::make_shared<Opm::ParallelOverlappingILU0<Matrix, Vector, Vector, Comm>>(
-                op.getmat(), comm, w, Opm::MILU_VARIANT::ILU, num_interior, redblack, reorder_spheres);
+                op.getmat(), comm, w, Opm::MILU_VARIANT::ILU, num_interior, redblack, reorder_spheres, rcm);
         } else {
             return std::make_shared<Opm::ParallelOverlappingILU0<Matrix, Vector, Vector, Comm>>(
-                op.getmat(), comm, ilulevel, w, Opm::MILU_VARIANT::ILU, redblack, reorder_spheres);
+                op.getmat(), comm, ilulevel, w, Opm::MILU_VARIANT::ILU, redblack, reorder_spheres, rcm);
         }
     }
 
@@ -334,14 +335,16 @@ private:
         doAddCreator("ParOverILU0", [](const O& op, const P& prm, const std::function<Vector()>&) {
             const double w = prm.get<double>("relaxation", 1.0);
             const int n = prm.get<int>("ilulevel", 0);
+            const bool rcm = prm.get<bool>("rcm", false);
             return std::make_shared<Opm::ParallelOverlappingILU0<M, V, V>>(
-                op.getmat(), n, w, Opm::MILU_VARIANT::ILU);
+                op.getmat(), n, w, Opm::MILU_VARIANT::ILU, false, false, rcm);
         });
         doAddCreator("ILUn", [](const O& op, const P& prm, const std::function<Vector()>&) {
             const int n = prm.get<int>("ilulevel", 0);
             const double w = prm.get<double>("relaxation", 1.0);
+            const bool rcm = prm.get<bool>("rcm", false);
             return std::make_shared<Opm::ParallelOverlappingILU0<M, V, V>>(
-                op.getmat(), n, w, Opm::MILU_VARIANT::ILU);
+                op.getmat(), n, w, Opm::MILU_VARIANT::ILU, false, false, rcm);
         });
         doAddCreator("Jac", [](const O& op, const P& prm, const std::function<Vector()>&) {
             const int n = prm.get<int>("repeats", 1);
@@ -0,0 +1,152 @@
+/*
+  Copyright 2021 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_PRESSURE_DIRECT_SOLVER_HEADER_INCLUDED
+#define OPM_PRESSURE_DIRECT_SOLVER_HEADER_INCLUDED
+
+#if HAVE_SUITESPARSE_UMFPACK
+
+#include <opm/common/ErrorMacros.hpp>
+
+#include <umfpack.h>
+
+#include <stdexcept>
+#include <vector>
+
+namespace Opm
+{
+
+/// Sparse LU solver for scalar (pressure) matrices with a fixed sparsity
+/// pattern, used as a direct coarse solver in CPR.
+///
+/// The row structure and the fill-reducing ordering (the UMFPack symbolic
+/// factorisation) are computed once in the constructor. update() only
+/// recomputes the numeric factorisation, and only if some matrix value has
+/// changed since the last factorisation.
+///
+/// \tparam Matrix A BCRSMatrix with 1x1 blocks.
+/// \tparam Vector A BlockVector with blocks of size 1.
+template <class Matrix, class Vector>
+class PressureDirectSolver
+{
+public:
+    explicit PressureDirectSolver(const Matrix& matrix)
+        : n_(matrix.N())
+    {
+        rowStart_.reserve(n_ + 1);
+        cols_.reserve(matrix.nonzeroes());
+        values_.reserve(matrix.nonzeroes());
+        rowStart_.push_back(0);
+        for (auto row = matrix.begin(); row != matrix.end(); ++row) {
+            for (auto col = row->begin(); col != row->end(); ++col) {
+                cols_.push_back(col.index());
+                values_.push_back((*col)[0][0]);
+            }
+            rowStart_.push_back(cols_.size());
+        }
+
+        umfpack_di_defaults(control_);
+        if (n_ == 0) {
+            return;
+        }
+        // The arrays hold A in CSR form, which UMFPack interprets as A^T in
+        // CSC form. The transpose is undone in apply().
+        const int status = umfpack_di_symbolic(n_, n_, rowStart_.data(), cols_.data(), values_.data(),
+                                               &symbolic_, control_, nullptr);
+        if (status != UMFPACK_OK) {
+            OPM_THROW(std::runtime_error, "UMFPack symbolic factorisation of the pressure matrix failed with status " << status);
+        }
+        factorize();
+    }
+
+    ~PressureDirectSolver()
+    {
+        if (numeric_) {
+            umfpack_di_free_numeric(&numeric_);
+        }
+        if (symbolic_) {
+            umfpack_di_free_symbolic(&symbolic_);
+        }
+    }
+
+    PressureDirectSolver(const PressureDirectSolver&) = delete;
+    PressureDirectSolver& operator=(const PressureDirectSolver&) = delete;
+
+    /// Refactorise if the values of the matrix differ from the ones of the
+    /// last factorisation. The sparsity pattern must be unchanged.
+    /// \return true if the matrix was refactorised.
+    bool update(const Matrix& matrix)
+    {
+        bool changed = false;
+        std::size_t idx = 0;
+        for (auto row = matrix.begin(); row != matrix.end(); ++row) {
+            for (auto col = row->begin(); col != row->end(); ++col, ++idx) {
+                const double value = (*col)[0][0];
+                if (value != values_[idx]) {
+                    values_[idx] = value;
+                    changed = true;
+                }
+            }
+        }
+        if (changed) {
+            factorize();
+        }
+        return changed;
+    }
+
+    /// Solve A x = b.
+    void apply(Vector& x, const Vector& b) const
+    {
+        if (n_ == 0) {
+            return;
+        }
+        const int status = umfpack_di_solve(UMFPACK_At, rowStart_.data(), cols_.data(), values_.data(),
+                                            &x[0][0], &b[0][0], numeric_, control_, nullptr);
+        if (status != UMFPACK_OK) {
+            OPM_THROW(std::runtime_error, "UMFPack solve with the pressure matrix failed with status " << status);
+        }
+    }
+
+private:
+    void factorize()
+    {
+        if (numeric_) {
+            umfpack_di_free_numeric(&numeric_);
+        }
+        const int status = umfpack_di_numeric(rowStart_.data(), cols_.data(), values_.data(),
+                                              symbolic_, &numeric_, control_, nullptr);
+        if (status != UMFPACK_OK) {
+            OPM_THROW(std::runtime_error, "UMFPack numeric factorisation of the pressure matrix failed with status " << status);
+        }
+    }
+
+    int n_;
+    std::vector<int> rowStart_;
+    std::vector<int> cols_;
+    std::vector<double> values_;
+    double control_[UMFPACK_CONTROL];
+    void* symbolic_ = nullptr;
+    void* numeric_ = nullptr;
+};
+
+} // namespace Opm
+
+#endif // HAVE_SUITESPARSE_UMFPACK
+
+#endif // OPM_PRESSURE_DIRECT_SOLVER_HEADER_INCLUDED
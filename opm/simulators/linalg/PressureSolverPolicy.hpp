@@ -20,6 +20,7 @@
 #ifndef OPM_PRESSURE_SOLVER_POLICY_HEADER_INCLUDED
 #define OPM_PRESSURE_SOLVER_POLICY_HEADER_INCLUDED
 
+#include <opm/simulators/linalg/PressureDirectSolver.hpp>
 #include <opm/simulators/linalg/PressureTransferPolicy.hpp>
 
 #include <boost/property_tree/ptree.hpp>
@@ -54,7 +55,10 @@ namespace Amg
          * @brief A wrapper that makes an inverse operator out of AMG.
          *
          * The operator will use one step of AMG to approximately solve
-         * the coarse level system.
+         * the coarse level system. In sequential runs a coarse system with
+         * at most "direct_max_size" rows is instead solved exactly with a
+         * sparse LU factorisation, which is reused until the matrix values
+         * change.
          */
         struct PressureInverseOperator : public Dune::InverseOperator<X, X>
         {
@@ -76,31 +80,77 @@ namespace Amg
                 : linsolver_()
             {
                 assert(op.category() != Dune::SolverCategory::overlapping);
+#if HAVE_SUITESPARSE_UMFPACK
+                const int direct_max_size = prm.get<int>("direct_max_size", 0);
+                if (op.getmat().N() > 0 && static_cast<int>(op.getmat().N()) <= direct_max_size) {
+                    op_ = &op;
+                    direct_solver_ = std::make_unique<DirectSolver>(op.getmat());
+                    return;
+                }
+#endif
                 linsolver_ = std::make_unique<Solver>(op, prm, std::function<X()>());
             }
 
 
             Dune::SolverCategory::Category category() const override
             {
+#if HAVE_SUITESPARSE_UMFPACK
+                if (direct_solver_) {
+                    return Dune::SolverCategory::sequential;
+                }
+#endif
                 return linsolver_->category();
             }
 
             void apply(X& x, X& b, double reduction, Dune::InverseOperatorResult& res) override
             {
+#if HAVE_SUITESPARSE_UMFPACK
+                if (direct_solver_) {
+                    applyDirect(x, b, res);
+                    return;
+                }
+#endif
                 linsolver_->apply(x, b, reduction, res);
             }
 
             void apply(X& x, X& b, Dune::InverseOperatorResult& res) override
             {
+#if HAVE_SUITESPARSE_UMFPACK
+                if (direct_solver_) {
+                    applyDirect(x, b, res);
+                    return;
+                }
+#endif
                 linsolver_->apply(x, b, res);
             }
 
             void updatePreconditioner()
             {
+#if HAVE_SUITESPARSE_UMFPACK
+                if (direct_solver_) {
+                    direct_solver_->update(op_->getmat());
+                    return;
+                }
+#endif
                 linsolver_->preconditioner().update();
             }
 
         private:
+#if HAVE_SUITESPARSE_UMFPACK
+            using DirectSolver = Opm::PressureDirectSolver<typename Operator::matrix_type, X>;
+
+            void applyDirect(X& x, const X& b, Dune::InverseOperatorResult& res)
+            {
+                direct_solver_->apply(x, b);
+                res.clear();
+                res.iterations = 1;
+                res.reduction = 0.0;
+                res.converged = true;
+            }
+
+            Operator* op_ = nullptr;
+            std::unique_ptr<DirectSolver> direct_solver_;
+#endif
             std::unique_ptr<Solver> linsolver_;
         };
 
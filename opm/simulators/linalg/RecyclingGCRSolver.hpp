@@ -0,0 +1,315 @@
+/*
+  Copyright 2021 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_RECYCLING_GCR_SOLVER_HEADER_INCLUDED
+#define OPM_RECYCLING_GCR_SOLVER_HEADER_INCLUDED
+
+#include <dune/common/timer.hh>
+#include <dune/istl/operators.hh>
+#include <dune/istl/preconditioner.hh>
+#include <dune/istl/scalarproducts.hh>
+#include <dune/istl/solver.hh>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+namespace Dune
+{
+
+/// Restarted, right preconditioned GCR solver that recycles a small
+/// subspace between consecutive solves.
+///
+/// At the end of each solve the search directions that contributed most
+/// to the solution are kept. Before the next solve their images under the
+/// (possibly changed) operator are recomputed and orthonormalized. The
+/// initial residual is then projected onto this space, and all new search
+/// directions are kept orthogonal to it. When the operator changes slowly,
+/// as between Newton iterations, the recycled directions approximate the
+/// slowly converging components of the error, which then do not have to
+/// be rebuilt by the Krylov iteration.
+///
+/// \tparam X The vector type.
+template <class X>
+class RecyclingGCRSolver : public InverseOperator<X, X>
+{
+public:
+    using field_type = typename X::field_type;
+
+    /// \param op        The operator.
+    /// \param sp        The scalar product.
+    /// \param prec      The preconditioner.
+    /// \param reduction The relative residual reduction to reach.
+    /// \param restart   The number of search directions before a restart.
+    /// \param recycle   The number of directions kept between solves.
+    /// \param maxit     The maximum number of iterations.
+    /// \param verbose   The verbosity level.
+    RecyclingGCRSolver(LinearOperator<X, X>& op,
+                       ScalarProduct<X>& sp,
+                       Preconditioner<X, X>& prec,
+                       double reduction,
+                       int restart,
+                       int recycle,
+                       int maxit,
+                       int verbose)
+        : op_(op)
+        , sp_(sp)
+        , prec_(prec)
+        , reduction_(reduction)
+        , restart_(std::max(restart, 1))
+        , recycle_(std::max(recycle, 0))
+        , maxit_(maxit)
+        , verbose_(verbose)
+    {
+    }
+
+    virtual void apply(X& x, X& b, InverseOperatorResult& res) override
+    {
+        Timer watch;
+        res.clear();
+        prec_.pre(x, b);
+
+        // r = b - A x
+        X& r = b;
+        op_.applyscaleadd(-1.0, x, r);
+        const field_type def0 = sp_.norm(r);
+
+        if (verbose_ > 0) {
+            std::cout << "=== RecyclingGCRSolver" << std::endl;
+            if (verbose_ > 1) {
+                this->printHeader(std::cout);
+                this->printOutput(std::cout, 0, def0);
+            }
+        }
+
+        candidates_.clear();
+        projectOnRecycledSpace_(x, r);
+
+        field_type def = sp_.norm(r);
+        int it = 0;
+        std::size_t numDirections = 0;
+        while (it < maxit_ && !converged_(def, def0)) {
+            if (numDirections == static_cast<std::size_t>(restart_)) {
+                numDirections = 0;
+            }
+            if (u_.size() <= numDirections) {
+                u_.emplace_back(x.size());
+                c_.emplace_back(x.size());
+            }
+            X& u = u_[numDirections];
+            X& c = c_[numDirections];
+
+            // u = M^{-1} r, c = A u
+            u = 0.0;
+            prec_.apply(u, r);
+            op_.apply(u, c);
+
+            // Orthogonalize c against the recycled and the current directions,
+            // and update u accordingly so that c = A u still holds.
+            for (std::size_t i = 0; i < recycledU_.size(); ++i) {
+                const field_type beta = sp_.dot(recycledC_[i], c);
+                c.axpy(-beta, recycledC_[i]);
+                u.axpy(-beta, recycledU_[i]);
+            }
+            for (std::size_t j = 0; j < numDirections; ++j) {
+                const field_type beta = sp_.dot(c_[j], c);
+                c.axpy(-beta, c_[j]);
+                u.axpy(-beta, u_[j]);
+            }
+            const field_type norm = sp_.norm(c);
+            if (!(norm > 0.0)) {
+                break; // breakdown, the preconditioned residual adds nothing new
+            }
+            c /= norm;
+            u /= norm;
+
+            const field_type alpha = sp_.dot(c, r);
+            x.axpy(alpha, u);
+            r.axpy(-alpha, c);
+            considerForRecycling_(u, alpha);
+
+            ++it;
+            ++numDirections;
+            const field_type defOld = def;
+            def = sp_.norm(r);
+            if (verbose_ > 1) {
+                this->printOutput(std::cout, it, def, defOld);
+            }
+        }
+
+        prec_.post(x);
+        updateRecycledSpace_();
+
+        res.iterations = it;
+        res.reduction = def0 > 0.0 ? def / def0 : 0.0;
+        res.converged = converged_(def, def0);
+        res.conv_rate = it > 0 ? std::pow(res.reduction, 1.0 / it) : 0.0;
+        res.elapsed = watch.elapsed();
+
+        if (verbose_ > 0) {
+            std::cout << "=== rate=" << res.conv_rate
+                      << ", T=" << res.elapsed
+                      << ", TIT=" << (it > 0 ? res.elapsed / it : 0.0)
+                      << ", IT=" << it
+                      << ", recycled=" << recycledU_.size() << std::endl;
+        }
+    }
+
+    virtual void apply(X& x, X& b, double reduction, InverseOperatorResult& res) override
+    {
+        const double savedReduction = reduction_;
+        reduction_ = reduction;
+        apply(x, b, res);
+        reduction_ = savedReduction;
+    }
+
+    virtual SolverCategory::Category category() const override
+    {
+        return SolverCategory::category(op_);
+    }
+
+private:
+    bool converged_(const field_type def, const field_type def0) const
+    {
+        return def <= def0 * reduction_ || def < 1e-30;
+    }
+
+    // Recompute C = A U for the current operator, orthonormalize C with
+    // modified Gram-Schmidt, and remove the components along C from the
+    // residual.
+    void projectOnRecycledSpace_(X& x, X& r)
+    {
+        std::size_t numKept = 0;
+        for (std::size_t i = 0; i < recycledU_.size(); ++i) {
+            if (numKept != i) {
+                std::swap(recycledU_[numKept], recycledU_[i]);
+                std::swap(recycledC_[numKept], recycledC_[i]);
+            }
+            X& u = recycledU_[numKept];
+            X& c = recycledC_[numKept];
+            op_.apply(u, c);
+            for (std::size_t j = 0; j < numKept; ++j) {
+                const field_type beta = sp_.dot(recycledC_[j], c);
+                c.axpy(-beta, recycledC_[j]);
+                u.axpy(-beta, recycledU_[j]);
+            }
+            const field_type norm = sp_.norm(c);
+            if (!(norm > 0.0)) {
+                continue; // direction has become linearly dependent
+            }
+            c /= norm;
+            u /= norm;
+            ++numKept;
+        }
+        recycledU_.resize(numKept);
+        recycledC_.resize(numKept);
+
+        for (std::size_t i = 0; i < recycledU_.size(); ++i) {
+            const field_type alpha = sp_.dot(recycledC_[i], r);
+            x.axpy(alpha, recycledU_[i]);
+            r.axpy(-alpha, recycledC_[i]);
+            candidates_.push_back({std::abs(alpha), i, true});
+        }
+    }
+
+    // Keep track of the recycle_ directions with the largest contributions
+    // to the solution. New directions are copied, since the Krylov vectors
+    // are overwritten after a restart.
+    void considerForRecycling_(const X& u, const field_type alpha)
+    {
+        if (recycle_ == 0) {
+            return;
+        }
+        const field_type weight = std::abs(alpha);
+        if (candidates_.size() >= static_cast<std::size_t>(recycle_)) {
+            auto smallest = std::min_element(candidates_.begin(), candidates_.end(),
+                                              [](const Candidate& a, const Candidate& b)
+                                              { return a.weight < b.weight; });
+            if (smallest->weight >= weight) {
+                return;
+            }
+            if (!smallest->recycled) {
+                // reuse the storage of the replaced direction
+                newU_[smallest->index] = u;
+                smallest->weight = weight;
+                return;
+            }
+            candidates_.erase(smallest);
+        }
+        const std::size_t index = numNew_();
+        if (newU_.size() <= index) {
+            newU_.push_back(u);
+        } else {
+            newU_[index] = u;
+        }
+        candidates_.push_back({weight, index, false});
+    }
+
+    std::size_t numNew_() const
+    {
+        return std::count_if(candidates_.begin(), candidates_.end(),
+                             [](const Candidate& c) { return !c.recycled; });
+    }
+
+    // Form the recycled space for the next solve from the selected
+    // directions. Only U is stored, C is recomputed in the next solve.
+    void updateRecycledSpace_()
+    {
+        std::vector<X> selected;
+        selected.reserve(candidates_.size());
+        for (const auto& candidate : candidates_) {
+            if (candidate.recycled) {
+                selected.push_back(std::move(recycledU_[candidate.index]));
+            } else {
+                selected.push_back(newU_[candidate.index]);
+            }
+        }
+        recycledU_ = std::move(selected);
+        recycledC_.resize(recycledU_.size(), X(recycledU_.empty() ? 0 : recycledU_.front().size()));
+    }
+
+    struct Candidate
+    {
+        field_type weight;
+        std::size_t index;
+        bool recycled;
+    };
+
+    LinearOperator<X, X>& op_;
+    ScalarProduct<X>& sp_;
+    Preconditioner<X, X>& prec_;
+    double reduction_;
+    int restart_;
+    int recycle_;
+    int maxit_;
+    int verbose_;
+
+    std::vector<X> u_;
+    std::vector<X> c_;
+    std::vector<X> recycledU_;
+    std::vector<X> recycledC_;
+    std::vector<X> newU_;
+    std::vector<Candidate> candidates_;
+};
+
+} // namespace Dune
+
+#endif // OPM_RECYCLING_GCR_SOLVER_HEADER_INCLUDED
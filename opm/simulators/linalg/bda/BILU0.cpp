@@ -110,6 +110,9 @@ BILU0<block_size>::~BILU0()
         if (opencl_ilu_reorder != ILUReorder::NONE) {
             delete[] CSCRowIndices;
             delete[] CSCColPointers;
+
+            // the sparsity pattern stays the same, so only the nonzeroes need to be reordered for every linear solve
+            reorderBlockedPatternByPattern<block_size>(mat, toOrder.data(), fromOrder.data(), rmat.get(), fromBlock);
         }
 
         diagIndex.resize(mat->Nb);
@@ -120,8 +123,6 @@ BILU0<block_size>::~BILU0()
         Umat = std::make_unique<BlockedMatrix<block_size> >(mat->Nb, (mat->nnzbs - mat->Nb) / 2);
 #endif
 
-        LUmat->nnzValues = new double[mat->nnzbs * bs * bs];
-
         s.invDiagVals = cl::Buffer(*context, CL_MEM_READ_WRITE, sizeof(double) * bs * bs * mat->Nb);
         s.rowsPerColor = cl::Buffer(*context, CL_MEM_READ_WRITE, sizeof(int) * (numColors + 1));
         s.diagIndex = cl::Buffer(*context, CL_MEM_READ_WRITE, sizeof(int) * LUmat->Nb);
@@ -509,10 +510,12 @@ BILU0<block_size>::~BILU0()
         const unsigned int bs = block_size;
         auto *m = mat;
 
+        copy_time = 0.0;
         if (opencl_ilu_reorder != ILUReorder::NONE) {
             m = rmat.get();
             Timer t_reorder;
-            reorderBlockedMatrixByPattern<block_size>(mat, toOrder.data(), fromOrder.data(), rmat.get());
+            reorderBlockedMatrixValues<block_size>(mat, fromBlock, rmat.get());
+            copy_time += t_reorder.elapsed();
 
             if (verbosity >= 3){
                 std::ostringstream out;
@@ -521,10 +524,12 @@ BILU0<block_size>::~BILU0()
             }
         }
 
+#if CHOW_PATEL
         // TODO: remove this copy by replacing inplace ilu decomp by out-of-place ilu decomp
         // this copy can have mat or rmat ->nnzValues as origin, depending on the reorder strategy
         Timer t_copy;
         memcpy(LUmat->nnzValues, m->nnzValues, sizeof(double) * bs * bs * m->nnzbs);
+        copy_time += t_copy.elapsed();
 
         if (verbosity >= 3){
             std::ostringstream out;
@@ -532,13 +537,14 @@ BILU0<block_size>::~BILU0()
             OpmLog::info(out.str());
         }
 
-#if CHOW_PATEL
         chow_patel_decomposition();
 #else
         Timer t_copyToGpu;
 
+        // the decomposition is done in place on the GPU, so the nonzeroes are uploaded
+        // directly from mat or rmat, depending on the reorder strategy
         events.resize(1);
-        queue->enqueueWriteBuffer(s.LUvals, CL_FALSE, 0, LUmat->nnzbs * bs * bs * sizeof(double), LUmat->nnzValues, nullptr, &events[0]);
+        queue->enqueueWriteBuffer(s.LUvals, CL_FALSE, 0, LUmat->nnzbs * bs * bs * sizeof(double), m->nnzValues, nullptr, &events[0]);
 
         std::call_once(pattern_uploaded, [&](){
             // find the positions of each diagonal block
@@ -563,6 +569,7 @@ BILU0<block_size>::~BILU0()
             // enqueueWriteBuffer is C and does not throw exceptions like C++ OpenCL
             OPM_THROW(std::logic_error, "BILU0 OpenCL enqueueWriteBuffer error");
         }
+        copy_time += t_copyToGpu.elapsed();
 
         if (verbosity >= 3) {
             std::ostringstream out;
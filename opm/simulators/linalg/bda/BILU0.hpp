@@ -65,6 +65,8 @@ namespace bda
         std::vector<int> rowsPerColor;  // color i contains rowsPerColor[i] rows, which are processed in parallel
         std::vector<int> rowsPerColorPrefix;  // the prefix sum of rowsPerColor
         std::vector<int> toOrder, fromOrder;
+        std::vector<int> fromBlock;     // for every block of rmat, the index of the block of the original matrix it comes from
+        double copy_time = 0.0;         // time in seconds spent reordering and copying the matrix in the last create_preconditioner()
         int numColors;
         int verbosity;
         std::once_flag pattern_uploaded;
@@ -141,6 +143,11 @@ namespace bda
             return rmat.get();
         }
 
+        double getCopyTime() const
+        {
+            return copy_time;
+        }
+
     };
 
 } // end namespace bda
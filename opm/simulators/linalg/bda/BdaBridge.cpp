@@ -250,6 +250,11 @@ void BdaBridge<BridgeMatrix, BridgeVector, block_size>::solve_system(BridgeMatri
         res.converged = result.converged;
         res.conv_rate = result.conv_rate;
         res.elapsed = result.elapsed;
+#if PRINT_TIMERS_BRIDGE
+        std::ostringstream out_copy;
+        out_copy << "BdaSolver copying the linear system took: " << result.copy_time << " s";
+        OpmLog::info(out_copy.str());
+#endif
     } else {
         res.converged = false;
     }
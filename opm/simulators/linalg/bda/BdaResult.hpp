@@ -34,6 +34,7 @@ public:
     bool converged = false;     // true iff the linear solver reached the desired norm within maxit iterations
     double conv_rate = 0.0;     // average reduction of norm per iteration, usually calculated with 'static_cast<double>(pow(res.reduction,1.0/it));'
     double elapsed = 0.0;       // time in seconds to run the linear solver
+    double copy_time = 0.0;     // time in seconds to copy (and reorder) the linear system to the linear solver, not included in elapsed
 
     // Dune 2.6 has a member 'double condition_estimate = -1' in InverseOperatorResult
 
@@ -115,7 +115,8 @@ bool FPGABILU0<block_size>::init(BlockedMatrix<block_size> *mat)
     int NROffsetSize = 0, LNROffsetSize = 0, UNROffsetSize = 0;
     int blockDiagSize = 0;
     // This reordering is needed here only to te result can be used to calculate worst-case scenario array sizes
-    reorderBlockedMatrixByPattern<bs>(mat, toOrder.data(), fromOrder.data(), rMat.get());
+    // The sparsity pattern stays the same, so later only the nonzeroes need to be reordered
+    reorderBlockedPatternByPattern<bs>(mat, toOrder.data(), fromOrder.data(), rMat.get(), fromBlock);
     int doneRows = 0;
     for (int c = 0; c < numColors; c++) {
         for (int i = doneRows; i < doneRows + rowsPerColor[c]; i++) {
@@ -234,7 +235,7 @@ bool FPGABILU0<block_size>::create_preconditioner(BlockedMatrix<block_size> *mat
 {
     const unsigned int bs = block_size;
     Timer t_reorder;
-    reorderBlockedMatrixByPattern<bs>(mat, toOrder.data(), fromOrder.data(), rMat.get());
+    reorderBlockedMatrixValues<bs>(mat, fromBlock, rMat.get());
 
     if (verbosity >= 3) {
         std::ostringstream out;
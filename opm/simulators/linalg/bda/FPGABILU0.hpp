@@ -48,6 +48,7 @@ private:
     double *invDiagVals = nullptr;
     std::vector<int> diagIndex;
     std::vector<int> toOrder, fromOrder;
+    std::vector<int> fromBlock; // for every block of rMat, the index of the block of the original matrix it comes from
     std::vector<int> rowsPerColor;
     int numColors;
     int verbosity;
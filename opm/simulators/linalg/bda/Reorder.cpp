@@ -17,7 +17,9 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
 #include <random>
+#include <utility>
 
 #include <opm/common/ErrorMacros.hpp>
 
@@ -192,6 +194,42 @@ void reorderBlockedMatrixByPattern(BlockedMatrix<block_size> *mat, int *toOrder,
     }
 }
 
+/* Reorder the sparsity pattern of a matrix and remember where every block comes from, such that
+ * the nonzeroes of later matrices with the same sparsity pattern can be reordered by a single gather. */
+
+template <unsigned int block_size>
+void reorderBlockedPatternByPattern(BlockedMatrix<block_size> *mat, int *toOrder, int *fromOrder, BlockedMatrix<block_size> *rmat, std::vector<int>& fromBlock) {
+    std::vector<std::pair<int, int> > row;  // (new column index, index of the block in mat)
+    fromBlock.resize(mat->nnzbs);
+
+    rmat->rowPointers[0] = 0;
+    for (int i = 0; i < mat->Nb; i++) {
+        int thisRow = fromOrder[i];
+        // put thisRow from the old matrix into row i of the new matrix
+        row.clear();
+        for (int k = mat->rowPointers[thisRow]; k < mat->rowPointers[thisRow + 1]; k++) {
+            row.emplace_back(toOrder[mat->colIndices[k]], k);
+        }
+        std::sort(row.begin(), row.end());
+
+        int rIndex = rmat->rowPointers[i];
+        for (const auto& entry : row) {
+            rmat->colIndices[rIndex] = entry.first;
+            fromBlock[rIndex] = entry.second;
+            rIndex++;
+        }
+        rmat->rowPointers[i + 1] = rIndex;
+    }
+}
+
+template <unsigned int block_size>
+void reorderBlockedMatrixValues(BlockedMatrix<block_size> *mat, const std::vector<int>& fromBlock, BlockedMatrix<block_size> *rmat) {
+    const unsigned int bs = block_size;
+    for (int i = 0; i < rmat->nnzbs; i++) {
+        std::copy_n(mat->nnzValues + fromBlock[i] * bs * bs, bs * bs, rmat->nnzValues + i * bs * bs);
+    }
+}
+
 /* Reorder a matrix according to the colors that every node of the matrix has received*/
 
 void colorsToReordering(int Nb, std::vector<int>& colors, int numColors, int *toOrder, int *fromOrder, std::vector<int>& rowsPerColor) {
@@ -355,6 +393,8 @@ void csrPatternToCsc(int *CSRColIndices, int *CSRRowPointers, int *CSCRowIndices
 #define INSTANTIATE_BDA_FUNCTIONS(n)                                                                                                            \
 template int colorBlockedNodes<n>(int, const int *, const int *, const int *, const int *, std::vector<int>&, int, int);                        \
 template void reorderBlockedMatrixByPattern<n>(BlockedMatrix<n> *, int *, int *, BlockedMatrix<n> *);                                           \
+template void reorderBlockedPatternByPattern<n>(BlockedMatrix<n> *, int *, int *, BlockedMatrix<n> *, std::vector<int>&);                       \
+template void reorderBlockedMatrixValues<n>(BlockedMatrix<n> *, const std::vector<int>&, BlockedMatrix<n> *);                                   \
 template void reorderBlockedVectorByPattern<n>(int, double*, int*, double*);                                                                    \
 template void findGraphColoring<n>(const int *, const int *, const int *, const int *, int, int, int, int *, int *, int *, std::vector<int>&);  \
 
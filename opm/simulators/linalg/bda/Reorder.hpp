@@ -54,6 +54,26 @@ int colorBlockedNodes(int rows, const int *CSRRowPointers, const int *CSRColIndi
 template <unsigned int block_size>
 void reorderBlockedMatrixByPattern(BlockedMatrix<block_size> *mat, int *toOrder, int *fromOrder, BlockedMatrix<block_size> *rmat);
 
+/// Reorder the sparsity pattern of the matrix according to the mapping in toOrder and fromOrder
+/// and find for every block of the reordered matrix the block of the original matrix it comes from
+/// Since the sparsity pattern does not change between linear solves, this only has to be done once,
+/// after that the nonzeroes can be reordered with reorderBlockedMatrixValues()
+/// rMat must be allocated already
+/// \param[in] mat             matrix to be reordered
+/// \param[in] toOrder         reorder pattern that lists for each index in the original order, to which index in the new order it should be moved
+/// \param[in] fromOrder       reorder pattern that lists for each index in the new order, from which index in the original order it was moved
+/// \param[inout] rMat         reordered Matrix, only the sparsity pattern is set
+/// \param[inout] fromBlock    output vector that lists for each block of rMat the index of the block of mat that is moved there
+template <unsigned int block_size>
+void reorderBlockedPatternByPattern(BlockedMatrix<block_size> *mat, int *toOrder, int *fromOrder, BlockedMatrix<block_size> *rmat, std::vector<int>& fromBlock);
+
+/// Copy the nonzeroes of the matrix into the reordered matrix, using the mapping found by reorderBlockedPatternByPattern()
+/// \param[in] mat             matrix to be reordered
+/// \param[in] fromBlock       lists for each block of rMat the index of the block of mat that is moved there
+/// \param[inout] rMat         reordered Matrix, its sparsity pattern must be set already
+template <unsigned int block_size>
+void reorderBlockedMatrixValues(BlockedMatrix<block_size> *mat, const std::vector<int>& fromBlock, BlockedMatrix<block_size> *rmat);
+
 /// Compute reorder mapping from the color that each node has received
 /// The toOrder, fromOrder and iters arrays must be allocated already
 /// \param[in] Nb              number of blocks in the vector
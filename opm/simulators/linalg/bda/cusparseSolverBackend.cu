@@ -478,12 +478,14 @@ void cusparseSolverBackend<block_size>::get_result(double *x) {
 
 template <unsigned int block_size>
 SolverStatus cusparseSolverBackend<block_size>::solve_system(int N, int nnz, int dim, double *vals, int *rows, int *cols, double *b, WellContributions& wellContribs, BdaResult &res) {
+    Timer t_copy;
     if (initialized == false) {
         initialize(N, nnz, dim);
         copy_system_to_gpu(vals, rows, cols, b);
     } else {
         update_system_on_gpu(vals, rows, b);
     }
+    const double copy_time = t_copy.stop();
     if (analysis_done == false) {
         if (!analyse_matrix()) {
             return SolverStatus::BDA_SOLVER_ANALYSIS_FAILED;
@@ -492,6 +494,7 @@ SolverStatus cusparseSolverBackend<block_size>::solve_system(int N, int nnz, int
     reset_prec_on_gpu();
     if (create_preconditioner()) {
         solve_system(wellContribs, res);
+        res.copy_time = copy_time;
     } else {
         return SolverStatus::BDA_SOLVER_CREATE_PRECONDITIONER_FAILED;
     }
@@ -781,6 +781,7 @@ void openclSolverBackend<block_size>::get_result(double *x) {
 
 template <unsigned int block_size>
 SolverStatus openclSolverBackend<block_size>::solve_system(int N_, int nnz_, int dim, double *vals, int *rows, int *cols, double *b, WellContributions& wellContribs, BdaResult &res) {
+    Timer t_copy(false);
     if (initialized == false) {
         initialize(N_, nnz_,  dim, vals, rows, cols);
         if (analysis_done == false) {
@@ -788,19 +789,28 @@ SolverStatus openclSolverBackend<block_size>::solve_system(int N_, int nnz_, int
                 return SolverStatus::BDA_SOLVER_ANALYSIS_FAILED;
             }
         }
+        t_copy.start();
         update_system(vals, b, wellContribs);
+        t_copy.stop();
         if (!create_preconditioner()) {
             return SolverStatus::BDA_SOLVER_CREATE_PRECONDITIONER_FAILED;
         }
+        t_copy.start();
         copy_system_to_gpu();
+        t_copy.stop();
     } else {
+        t_copy.start();
         update_system(vals, b, wellContribs);
+        t_copy.stop();
         if (!create_preconditioner()) {
             return SolverStatus::BDA_SOLVER_CREATE_PRECONDITIONER_FAILED;
         }
+        t_copy.start();
         update_system_on_gpu();
+        t_copy.stop();
     }
     solve_system(wellContribs, res);
+    res.copy_time = t_copy.elapsed() + prec->getCopyTime();
     return SolverStatus::BDA_SOLVER_SUCCESS;
 }
 
@@ -20,10 +20,14 @@
 #ifndef OPM_GET_QUASI_IMPES_WEIGHTS_HEADER_INCLUDED
 #define OPM_GET_QUASI_IMPES_WEIGHTS_HEADER_INCLUDED
 
+#include <opm/models/parallel/threadedentityiterator.hh>
+
 #include <dune/common/fvector.hh>
 
 #include <algorithm>
 #include <cmath>
+#include <exception>
+#include <type_traits>
 
 namespace Opm
 {
@@ -85,46 +89,80 @@ namespace Amg
         return weights;
     }
 
-    template<class Vector, class GridView, class ElementContext, class Model>
-    void getTrueImpesWeights(int pressureVarIndex, Vector& weights, const GridView& gridView,
-                             ElementContext& elemCtx, const Model& model, std::size_t threadId)
+    /// Compute the true-IMPES weights, i.e. weights that make the storage
+    /// term of the pressure equation independent of all other primary
+    /// variables. The storage derivatives are evaluated from the intensive
+    /// quantities of the last linearization, which are read from the cache
+    /// of the model if it is enabled. The elements are distributed over the
+    /// threads in the same way as in the linearizer.
+    template<class Vector, class ElementContext, class ThreadManager, class Simulator>
+    void getTrueImpesWeights(int pressureVarIndex, Vector& weights, const Simulator& simulator)
     {
         using VectorBlockType = typename Vector::block_type;
+        const auto& model = simulator.model();
         using Matrix = typename std::decay_t<decltype(model.linearizer().jacobian())>;
         using MatrixBlockType = typename Matrix::MatrixBlock;
         constexpr int numEq = VectorBlockType::size();
-        using Evaluation = typename std::decay_t<decltype(model.localLinearizer(threadId).localResidual().residual(0))>
+        using Evaluation = typename std::decay_t<decltype(model.localLinearizer(0).localResidual().residual(0))>
             ::block_type;
+        using GridView = std::decay_t<decltype(simulator.vanguard().gridView())>;
+        using ElementIterator = typename GridView::template Codim<0>::Iterator;
+
         VectorBlockType rhs(0.0);
         rhs[pressureVarIndex] = 1.0;
-        int index = 0;
-        auto elemIt = gridView.template begin</*codim=*/0>();
-        const auto& elemEndIt = gridView.template end</*codim=*/0>();
-        for (; elemIt != elemEndIt; ++elemIt) {
-            elemCtx.updatePrimaryStencil(*elemIt);
-            elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
+        const double pressure_scale = 50e5;
+        const double dt = simulator.timeStepSize();
+
+        // An exception must not leave the parallel region, since that would
+        // call std::terminate(). The first one is kept and rethrown after it,
+        // so that e.g. a singular block still leads to a time step cut.
+        std::exception_ptr exception;
+        ThreadedEntityIterator<GridView, /*codim=*/0> threadedElemIt(simulator.vanguard().gridView());
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            const unsigned threadId = ThreadManager::threadId();
+            const auto& localResidual = model.localLinearizer(threadId).localResidual();
+            ElementContext elemCtx(simulator);
             Dune::FieldVector<Evaluation, numEq> storage;
-            model.localLinearizer(threadId).localResidual().computeStorage(storage,elemCtx,/*spaceIdx=*/0, /*timeIdx=*/0);
-            auto extrusionFactor = elemCtx.intensiveQuantities(0, /*timeIdx=*/0).extrusionFactor();
-            auto scvVolume = elemCtx.stencil(/*timeIdx=*/0).subControlVolume(0).volume() * extrusionFactor;
-            auto storage_scale = scvVolume / elemCtx.simulator().timeStepSize();
             MatrixBlockType block;
-            double pressure_scale = 50e5;
-            for (int ii = 0; ii < numEq; ++ii) {
-                for (int jj = 0; jj < numEq; ++jj) {
-                    block[ii][jj] = storage[ii].derivative(jj)/storage_scale;
-                    if (jj == pressureVarIndex) {
-                        block[ii][jj] *= pressure_scale;
+            MatrixBlockType block_transpose;
+            VectorBlockType bweights;
+
+            try {
+                ElementIterator elemIt = threadedElemIt.beginParallel();
+                for (; !threadedElemIt.isFinished(elemIt); elemIt = threadedElemIt.increment()) {
+                    elemCtx.updatePrimaryStencil(*elemIt);
+                    elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
+                    localResidual.computeStorage(storage, elemCtx, /*spaceIdx=*/0, /*timeIdx=*/0);
+                    const auto extrusionFactor = elemCtx.intensiveQuantities(0, /*timeIdx=*/0).extrusionFactor();
+                    const auto scvVolume = elemCtx.stencil(/*timeIdx=*/0).subControlVolume(0).volume() * extrusionFactor;
+                    const auto storage_scale = scvVolume / dt;
+                    for (int ii = 0; ii < numEq; ++ii) {
+                        for (int jj = 0; jj < numEq; ++jj) {
+                            block[ii][jj] = storage[ii].derivative(jj)/storage_scale;
+                            if (jj == pressureVarIndex) {
+                                block[ii][jj] *= pressure_scale;
+                            }
+                            block_transpose[jj][ii] = block[ii][jj];
+                        }
                     }
+                    block_transpose.solve(bweights, rhs);
+                    bweights /= 1000.0; // given normal densities this scales weights to about 1.
+                    weights[elemCtx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0)] = bweights;
                 }
             }
-            VectorBlockType bweights;
-            MatrixBlockType block_transpose = Details::transposeDenseMatrix(block);
-            block_transpose.solve(bweights, rhs);
-            bweights /= 1000.0; // given normal densities this scales weights to about 1.
-            weights[index] = bweights;
-            ++index;
+            catch (...) {
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+                if (!exception)
+                    exception = std::current_exception();
+            }
         }
+        if (exception)
+            std::rethrow_exception(exception);
     }
 } // namespace Amg
 
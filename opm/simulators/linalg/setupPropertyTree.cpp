@@ -21,7 +21,12 @@
 
 #include <opm/simulators/linalg/setupPropertyTree.hpp>
 
+#include <opm/common/ErrorMacros.hpp>
+
 #include <boost/property_tree/json_parser.hpp>
+
+#include <algorithm>
+#include <sstream>
 #include <boost/version.hpp>
 
 namespace Opm
@@ -49,6 +54,7 @@ setupCPR(const std::string& conf, const FlowLinearSolverParameters& p)
     prm.put("preconditioner.coarsesolver.tol", 1e-1);
     prm.put("preconditioner.coarsesolver.solver", "loopsolver");
     prm.put("preconditioner.coarsesolver.verbosity", 0);
+    prm.put("preconditioner.coarsesolver.direct_max_size", p.cpr_direct_coarse_max_size_);
     prm.put("preconditioner.coarsesolver.preconditioner.type", "amg");
     prm.put("preconditioner.coarsesolver.preconditioner.alpha", 0.333333333333);
     prm.put("preconditioner.coarsesolver.preconditioner.relaxation", 1.0);
@@ -118,9 +124,54 @@ setupILU([[maybe_unused]] const std::string& conf, const FlowLinearSolverParamet
     prm.put("preconditioner.type", "ParOverILU0");
     prm.put("preconditioner.relaxation", p.ilu_relaxation_);
     prm.put("preconditioner.ilulevel", p.ilu_fillin_level_);
+    prm.put("preconditioner.rcm", p.ilu_reorder_rcm_);
     return prm;
 }
 
 
+std::vector<std::pair<std::string, boost::property_tree::ptree>>
+setupFallbackChain(const std::string& chain, const boost::property_tree::ptree& prm, const FlowLinearSolverParameters& p)
+{
+    std::vector<std::pair<std::string, boost::property_tree::ptree>> fallbacks;
+    const int maxiter = prm.get<int>("maxiter", p.linear_solver_maxiter_);
+    std::istringstream is(chain);
+    std::string stage;
+    while (std::getline(is, stage, ',')) {
+        stage.erase(std::remove(stage.begin(), stage.end(), ' '), stage.end());
+        if (stage.empty()) {
+            continue;
+        }
+        boost::property_tree::ptree fallback;
+        if (stage == "gmres") {
+            // Restarted GMRES with a long restart length and the same preconditioner.
+            fallback = prm;
+            fallback.put("solver", "gmres");
+            fallback.put("restart", 4 * p.linear_solver_restart_);
+        } else if (stage == "cpr") {
+            // CPR with a freshly computed setup, regardless of CprReuseSetup.
+            FlowLinearSolverParameters q = p;
+            q.linear_solver_maxiter_ = maxiter;
+            fallback = setupCPR("cpr_trueimpes", q);
+        } else if (stage == "ilu") {
+            // ILU with more fill-in than configured.
+            FlowLinearSolverParameters q = p;
+            q.linear_solver_maxiter_ = maxiter;
+            q.ilu_fillin_level_ = std::max(p.ilu_fillin_level_ + 1, 1);
+            fallback = setupILU("ilu0", q);
+        } else if (stage == "maxiter") {
+            // The configured solver with a larger iteration cap.
+            fallback = prm;
+            fallback.put("maxiter", 5 * maxiter);
+        } else {
+            OPM_THROW(std::invalid_argument,
+                      stage << " is not a valid stage for --linear-solver-fallback."
+                      << " Valid stages are gmres, cpr, ilu and maxiter.");
+        }
+        fallbacks.emplace_back(stage, fallback);
+    }
+    return fallbacks;
+}
+
+
 
 } // namespace Opm
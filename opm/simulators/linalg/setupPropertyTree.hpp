@@ -24,6 +24,10 @@
 
 #include <boost/property_tree/ptree.hpp>
 
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace Opm
 {
 
@@ -34,6 +38,12 @@ boost::property_tree::ptree setupCPR(const std::string& conf, const FlowLinearSo
 boost::property_tree::ptree setupAMG(const std::string& conf, const FlowLinearSolverParameters& p);
 boost::property_tree::ptree setupILU(const std::string& conf, const FlowLinearSolverParameters& p);
 
+/// Set up the solver configurations that are tried, in order, on the same
+/// linear system if the solver configured by prm does not converge.
+/// \param chain Comma separated list of the stages, see --linear-solver-fallback.
+std::vector<std::pair<std::string, boost::property_tree::ptree>>
+setupFallbackChain(const std::string& chain, const boost::property_tree::ptree& prm, const FlowLinearSolverParameters& p);
+
 } // namespace Opm
 
 #include "setupPropertyTree_impl.hpp"
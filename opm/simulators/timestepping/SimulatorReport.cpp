@@ -38,6 +38,7 @@ namespace Opm
           assemble_time(0.0),
           pre_post_time(0.0),
           assemble_time_well(0.0),
+          well_state_copy_time(0.0),
           linear_solve_setup_time(0.0),
           linear_solve_time(0.0),
           update_time(0.0),
@@ -63,6 +64,7 @@ namespace Opm
         assemble_time += sr.assemble_time;
         pre_post_time += sr.pre_post_time;
         assemble_time_well += sr.assemble_time_well;
+        well_state_copy_time += sr.well_state_copy_time;
         update_time += sr.update_time;
         output_write_time += sr.output_write_time;
         total_time += sr.total_time;
@@ -118,6 +120,15 @@ namespace Opm
             }
             os << std::endl;
 
+            t = well_state_copy_time + (failureReport ? failureReport->well_state_copy_time : 0.0);
+            os << fmt::format("   Well state copy (seconds): {:7.2f}", t);
+            if (failureReport) {
+              os << fmt::format(" (Failed: {:2.1f}; {:2.1f}%)",
+                                failureReport->well_state_copy_time,
+                                100*failureReport->well_state_copy_time/t);
+            }
+            os << std::endl;
+
             t = linear_solve_time + (failureReport ? failureReport->linear_solve_time : 0.0);
             os << fmt::format(" Linear solve time (seconds):{:8.2f}", t);
             if (failureReport) {
@@ -235,4 +246,50 @@ namespace Opm
         }
     }
 
+    void SimulatorReport::reportStepCsvHeader(std::ostream& os)
+    {
+        os << "ReportStep,Time(day),TStep(day),Substeps,Chops,Solver,Assembly,WellAssembly,WellStateCopy,"
+              "LSetup,LSolve,Update,PrePost,Output,WellIt,Lins,NewtIt,LinIt,"
+              "FailedAssembly,FailedLSetup,FailedLSolve,FailedUpdate,FailedLins,FailedNewtIt,FailedLinIt\n";
+    }
+
+    void SimulatorReport::reportStepCsv(std::ostream& os, int reportStep, double time, double stepLength) const
+    {
+        int chops = 0;
+        for (const auto& sr : this->stepreports) {
+            if (!sr.converged) {
+                ++chops;
+            }
+        }
+        const int substeps = static_cast<int>(this->stepreports.size()) - chops;
+
+        os << fmt::format("{},{:.10g},{:.10g},{},{},", reportStep,
+                          unit::convert::to(time, unit::day),
+                          unit::convert::to(stepLength, unit::day),
+                          substeps, chops);
+        os << fmt::format("{:.4f},{:.4f},{:.4f},{:.4f},{:.4f},{:.4f},{:.4f},{:.4f},{:.4f},",
+                          success.solver_time,
+                          success.assemble_time,
+                          success.assemble_time_well,
+                          success.well_state_copy_time,
+                          success.linear_solve_setup_time,
+                          success.linear_solve_time,
+                          success.update_time,
+                          success.pre_post_time,
+                          success.output_write_time);
+        os << fmt::format("{},{},{},{},",
+                          success.total_well_iterations,
+                          success.total_linearizations,
+                          success.total_newton_iterations,
+                          success.total_linear_iterations);
+        os << fmt::format("{:.4f},{:.4f},{:.4f},{:.4f},{},{},{}\n",
+                          failure.assemble_time,
+                          failure.linear_solve_setup_time,
+                          failure.linear_solve_time,
+                          failure.update_time,
+                          failure.total_linearizations,
+                          failure.total_newton_iterations,
+                          failure.total_linear_iterations);
+    }
+
 } // namespace Opm
@@ -36,6 +36,7 @@ namespace Opm
         double assemble_time;
         double pre_post_time;
         double assemble_time_well;
+        double well_state_copy_time;
         double linear_solve_setup_time;
         double linear_solve_time;
         double update_time;
@@ -72,6 +73,15 @@ namespace Opm
         void operator+=(const SimulatorReport& sr);
         void reportFullyImplicit(std::ostream& os) const;
         void fullReports(std::ostream& os) const;
+        /// Print the header line of the records written by reportStepCsv().
+        static void reportStepCsvHeader(std::ostream& os);
+        /// Print one comma-separated line with the timings and counters of
+        /// this report, which is expected to cover a single report step.
+        /// Work spent on chopped substeps is taken from the failure report.
+        /// \param[in] reportStep  index of the report step
+        /// \param[in] time        simulation time at the end of the step (seconds)
+        /// \param[in] stepLength  length of the report step (seconds)
+        void reportStepCsv(std::ostream& os, int reportStep, double time, double stepLength) const;
     };
 
     } // namespace Opm
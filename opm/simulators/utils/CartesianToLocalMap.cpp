@@ -0,0 +1,56 @@
+/*
+  Copyright 2021 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+#include <opm/simulators/utils/CartesianToLocalMap.hpp>
+
+#include <algorithm>
+
+namespace Opm
+{
+
+CartesianToLocalMap::CartesianToLocalMap(const std::vector<int>& cartesianIndex)
+{
+    const auto numMapped = std::count_if(cartesianIndex.begin(), cartesianIndex.end(),
+                                         [](const int cartIdx) { return cartIdx >= 0; });
+    entries_.reserve(numMapped);
+    for (std::size_t localIdx = 0; localIdx < cartesianIndex.size(); ++localIdx) {
+        if (cartesianIndex[localIdx] >= 0) {
+            entries_.emplace_back(cartesianIndex[localIdx], static_cast<int>(localIdx));
+        }
+    }
+
+    // The local cells are typically ordered by Cartesian index already.
+    if (!std::is_sorted(entries_.begin(), entries_.end())) {
+        std::sort(entries_.begin(), entries_.end());
+    }
+}
+
+int CartesianToLocalMap::operator[](const int cartesianIdx) const
+{
+    const auto it = std::lower_bound(entries_.begin(), entries_.end(), cartesianIdx,
+                                     [](const Entry& entry, const int cartIdx)
+                                     { return entry.first < cartIdx; });
+    if (it == entries_.end() || it->first != cartesianIdx) {
+        return -1;
+    }
+    return it->second;
+}
+
+} // namespace Opm
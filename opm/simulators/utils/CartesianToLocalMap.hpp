@@ -0,0 +1,70 @@
+/*
+  Copyright 2021 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_CARTESIANTOLOCALMAP_HEADER_INCLUDED
+#define OPM_CARTESIANTOLOCALMAP_HEADER_INCLUDED
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace Opm
+{
+
+    /// Map from logically Cartesian cell indices to local (compressed)
+    /// cell indices.
+    ///
+    /// Only the mapped cells are stored, as (Cartesian, local) index pairs
+    /// sorted on the Cartesian index and looked up by binary search. The
+    /// memory use is hence proportional to the number of local cells
+    /// instead of to the size of the logically Cartesian grid.
+    class CartesianToLocalMap
+    {
+    public:
+        CartesianToLocalMap() = default;
+
+        /// Create the map from the Cartesian indices of the local cells.
+        /// cartesianIndex[i] is the Cartesian index of local cell i, cells
+        /// with a negative Cartesian index are left out of the map.
+        explicit CartesianToLocalMap(const std::vector<int>& cartesianIndex);
+
+        /// Local index of the cell with the given Cartesian index, or -1
+        /// if that cell is not in the map.
+        int operator[](int cartesianIdx) const;
+
+        /// Number of mapped cells.
+        std::size_t size() const
+        {
+            return entries_.size();
+        }
+
+        /// Number of bytes used to store the map.
+        std::size_t memoryUsage() const
+        {
+            return entries_.capacity() * sizeof(Entry);
+        }
+
+    private:
+        using Entry = std::pair<int, int>;
+        std::vector<Entry> entries_;
+    };
+
+} // namespace Opm
+
+#endif // OPM_CARTESIANTOLOCALMAP_HEADER_INCLUDED
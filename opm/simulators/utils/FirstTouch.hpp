@@ -0,0 +1,94 @@
+/*
+  Copyright 2021 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_FIRSTTOUCH_HEADER_INCLUDED
+#define OPM_FIRSTTOUCH_HEADER_INCLUDED
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Opm
+{
+
+    /// Allocator which default-initializes elements that are constructed
+    /// without arguments instead of value-initializing them. For trivial
+    /// types, resizing a vector using this allocator therefore does not write
+    /// to the newly allocated memory, and the operating system places each
+    /// page on the NUMA node of the thread that writes to it first.
+    template <class T>
+    class FirstTouchAllocator : public std::allocator<T>
+    {
+    public:
+        template <class U>
+        struct rebind
+        {
+            using other = FirstTouchAllocator<U>;
+        };
+
+        FirstTouchAllocator() noexcept = default;
+
+        template <class U>
+        FirstTouchAllocator(const FirstTouchAllocator<U>&) noexcept
+        {
+        }
+
+        template <class U>
+        void construct(U* p) noexcept(std::is_nothrow_default_constructible<U>::value)
+        {
+            ::new (static_cast<void*>(p)) U;
+        }
+
+        template <class U, class... Args>
+        void construct(U* p, Args&&... args)
+        {
+            ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+        }
+    };
+
+    template <class T>
+    using FirstTouchVector = std::vector<T, FirstTouchAllocator<T>>;
+
+    /// Replace the content of a vector by n copies of value, written in a
+    /// statically scheduled OpenMP loop. Thread i thus writes the i-th
+    /// contiguous chunk of the vector, so for a FirstTouchVector the pages
+    /// are spread over the NUMA nodes of the threads in contiguous chunks.
+    /// This only interleaves the pages: loops which hand out the elements
+    /// dynamically, like the ThreadedEntityIterator, do not read the chunk a
+    /// thread has touched from that thread. The previous storage is released
+    /// first, so that the pages are always freshly allocated.
+    template <class Vector>
+    void firstTouchAssign(Vector& v, const std::size_t n, const typename Vector::value_type& value)
+    {
+        Vector().swap(v);
+        v.resize(n);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (std::size_t i = 0; i < n; ++i) {
+            v[i] = value;
+        }
+    }
+
+} // namespace Opm
+
+#endif // OPM_FIRSTTOUCH_HEADER_INCLUDED
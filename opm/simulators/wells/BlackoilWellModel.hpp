@@ -38,6 +38,7 @@
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <stddef.h>
@@ -69,11 +70,13 @@
 #include <opm/simulators/wells/ParallelWellInfo.hpp>
 #include <opm/simulators/timestepping/gatherConvergenceReport.hpp>
 #include <dune/common/fmatrix.hh>
+#include <dune/common/timer.hh>
 #include <dune/istl/bcrsmatrix.hh>
 #include <dune/istl/matrixmatrix.hh>
 
 #include <opm/material/densead/Math.hpp>
 
+#include <opm/simulators/utils/CartesianToLocalMap.hpp>
 #include <opm/simulators/utils/DeferredLogger.hpp>
 
 namespace Opm::Properties {
@@ -259,10 +262,14 @@ namespace Opm {
             }
 
             /*
-              Mutable version of the currently active wellstate.
+              Mutable version of the currently active wellstate. Since the
+              caller may modify the state through the returned reference the
+              well part of the active WGState is flagged as modified, and will
+              be copied on the next commitWGState() or resetWGState().
             */
             WellStateFullyImplicitBlackoil& wellState()
             {
+                this->active_well_state_modified_ = true;
                 return this->active_wgstate_.well_state;
             }
 
@@ -296,10 +303,14 @@ namespace Opm {
               current value of the this->active_well_state_. The state stored
               with storeWellState() can then subsequently be recovered with the
               resetWellState() method.
+
+              Only the parts of the active state which have been handed out
+              through the mutable accessors since the previous commit or reset
+              are copied; when nothing has been touched this is a no-op.
             */
             void commitWGState()
             {
-                this->last_valid_wgstate_ = this->active_wgstate_;
+                this->syncWGState(this->last_valid_wgstate_, this->active_wgstate_);
             }
 
             /*
@@ -310,16 +321,21 @@ namespace Opm {
             void commitWGState(WGState wgstate)
             {
                 this->last_valid_wgstate_ = std::move(wgstate);
+                // The committed state is no longer known to be equal to the
+                // active state.
+                this->active_well_state_modified_ = true;
+                this->active_group_state_modified_ = true;
             }
 
             /*
               Will update the internal variable active_well_state_ to whatever
               was stored in the last_valid_well_state_ member. This function
               works in pair with commitWellState() which should be called first.
+              As for commitWGState() only the modified parts are copied.
             */
             void resetWGState()
             {
-                this->active_wgstate_ = this->last_valid_wgstate_;
+                this->syncWGState(this->active_wgstate_, this->last_valid_wgstate_);
             }
 
             /*
@@ -329,7 +345,10 @@ namespace Opm {
             */
             void updateNupcolWGState()
             {
+                Dune::Timer copyTimer;
+                copyTimer.start();
                 this->nupcol_wgstate_ = this->active_wgstate_;
+                this->wgstate_copy_time_ += copyTimer.stop();
             }
 
             const GroupState& groupState() const
@@ -368,10 +387,21 @@ namespace Opm {
             // Check if well equations is converged.
             ConvergenceReport getWellConvergence(const std::vector<Scalar>& B_avg, const bool checkGroupConvergence = false) const;
 
+            // Solve the well equations of all wells with the reservoir state
+            // kept fixed. Returns true if they converged on all processes.
+            bool solveWellEquationsWithFrozenReservoir();
+
             const PhaseUsage& phaseUsage() const { return phase_usage_; }
 
             const SimulatorReportSingle& lastReport() const;
 
+            /// Return the time spent copying well and group states since the
+            /// last call, and reset it.
+            double takeWGStateCopyTime()
+            {
+                return std::exchange(this->wgstate_copy_time_, 0.0);
+            }
+
             void addWellContributions(SparseMatrixAdapter& jacobian) const
             {
                 for ( const auto& well: well_container_ ) {
@@ -395,6 +425,9 @@ namespace Opm {
             double wellPI(const std::string& well_name) const;
 
             void updatePerforationIntensiveQuantities();
+
+            void updatePerforatedCells();
+            void updateCellRates();
             // it should be able to go to prepareTimeStep(), however, the updateWellControls() and initPrimaryVariablesEvaluation()
             // makes it a little more difficult. unless we introduce if (iterationIdx != 0) to avoid doing the above functions
             // twice at the beginning of the time step
@@ -426,9 +459,16 @@ namespace Opm {
             // Map from logically cartesian cell indices to compressed ones.
             // Cells not in the interior are not mapped. This deactivates
             // these for distributed wells and makes the distribution non-overlapping.
-            std::vector<int> cartesian_to_compressed_{};
+            CartesianToLocalMap cartesian_to_compressed_{};
 
-            std::vector<bool> is_cell_perforated_{};
+            // Index of each local cell into cell_rates_, -1 for cells
+            // without any perforation.
+            std::vector<int> perforated_cell_index_{};
+
+            // Sum of the connection rates of all perforations in each
+            // perforated cell, refreshed after the well equations have
+            // been assembled so the reservoir source term is a lookup.
+            std::vector<RateVector> cell_rates_{};
 
             std::function<bool(const Well&)> not_on_process_{};
 
@@ -486,6 +526,18 @@ namespace Opm {
 
             std::vector<Scalar> B_avg_{};
 
+            // Globally summed well rates of all groups in the hierarchy,
+            // surface and reservoir rates of producers and injectors.  Only
+            // set while group controls are updated, see computeGroupRateSums().
+            struct GroupRateSums
+            {
+                std::vector<double> production;
+                std::vector<double> injection;
+                std::vector<double> production_resv;
+                std::vector<double> injection_resv;
+            };
+            std::optional<std::map<std::string, GroupRateSums>> group_rate_sums_{};
+
             const Grid& grid() const
             { return ebosSimulator_.vanguard().grid(); }
 
@@ -530,7 +582,7 @@ namespace Opm {
             // setting the well_solutions_ based on well_state.
             void updatePrimaryVariables(DeferredLogger& deferred_logger);
 
-            void setupCartesianToCompressed_(const int* global_cell, int local_num__cells);
+            void setupCartesianToCompressed_(const int* global_cell);
 
             void setRepRadiusPerfLength();
 
@@ -605,7 +657,15 @@ namespace Opm {
             void checkGconsaleLimits(const Group& group, WellState& well_state, DeferredLogger& deferred_logger );
 
             void updateGroupHigherControls(DeferredLogger& deferred_logger, std::set<std::string>& switched_groups);
-            void checkGroupHigherConstraints(const Group& group, DeferredLogger& deferred_logger, std::set<std::string>& switched_groups);
+            void checkGroupHigherConstraints(const Group& group, const std::vector<double>& resv_coeff, DeferredLogger& deferred_logger, std::set<std::string>& switched_groups);
+
+            // Compute the globally summed well rates of all groups, used by
+            // the group constraint checks until clearGroupRateSums().
+            void computeGroupRateSums();
+            void clearGroupRateSums();
+            // Globally summed rate of phase phasePos of the producers or
+            // injectors in group, at surface or reservoir conditions.
+            double groupRateSum(const Group& group, const int phasePos, const bool injector, const bool reservoir) const;
 
             void actionOnBrokenConstraints(const Group& group, const Group::ExceedAction& exceed_action, const Group::ProductionCMode& newControl, DeferredLogger& deferred_logger);
 
@@ -645,7 +705,35 @@ namespace Opm {
 
              void computeWellTemperature();                       
         private:
-            GroupState& groupState() { return this->active_wgstate_.group_state; }
+            GroupState& groupState()
+            {
+                this->active_group_state_modified_ = true;
+                return this->active_wgstate_.group_state;
+            }
+
+            /*
+              Copy the parts of the active WGState which have been modified
+              since the last synchronisation between 'from' and 'to', and
+              record the time spent in wgstate_copy_time_.
+            */
+            void syncWGState(WGState& to, const WGState& from)
+            {
+                if (!this->active_well_state_modified_ && !this->active_group_state_modified_)
+                    return;
+
+                Dune::Timer copyTimer;
+                copyTimer.start();
+                if (this->active_well_state_modified_)
+                    to.well_state = from.well_state;
+
+                if (this->active_group_state_modified_)
+                    to.group_state = from.group_state;
+
+                this->active_well_state_modified_ = false;
+                this->active_group_state_modified_ = false;
+                this->wgstate_copy_time_ += copyTimer.stop();
+            }
+
             BlackoilWellModel(Simulator& ebosSimulator, const PhaseUsage& pu);
             /*
               The various wellState members should be accessed and modified
@@ -657,6 +745,16 @@ namespace Opm {
             WGState last_valid_wgstate_;
             WGState nupcol_wgstate_;
 
+            // Whether the well and group parts of active_wgstate_ may differ
+            // from last_valid_wgstate_, i.e. whether they have been handed out
+            // through a mutable accessor since the last commit or reset.
+            bool active_well_state_modified_{true};
+            bool active_group_state_modified_{true};
+
+            // Time spent copying WGState instances since the last call of
+            // takeWGStateCopyTime().
+            double wgstate_copy_time_{0.0};
+
         };
 
 
@@ -54,9 +54,7 @@ namespace Opm {
         // Set up cartesian mapping.
         {
             const auto& grid = this->ebosSimulator_.vanguard().grid();
-            const auto& cartDims = UgGridHelpers::cartDims(grid);
-            setupCartesianToCompressed_(UgGridHelpers::globalCell(grid),
-                                        cartDims[0] * cartDims[1] * cartDims[2]);
+            setupCartesianToCompressed_(UgGridHelpers::globalCell(grid));
 
             auto& parallel_wells = ebosSimulator.vanguard().parallelWells();
             this->parallel_well_info_.assign(parallel_wells.begin(),
@@ -104,7 +102,7 @@ namespace Opm {
         // add the eWoms auxiliary module for the wells to the list
         ebosSimulator_.model().addAuxiliaryModule(this);
 
-        is_cell_perforated_.resize(local_num_cells_, false);
+        perforated_cell_index_.resize(local_num_cells_, -1);
     }
 
     template<typename TypeTag>
@@ -130,14 +128,25 @@ namespace Opm {
             for ( size_t c=0; c < connectionSet.size(); c++ )
             {
                 const auto& connection = connectionSet.get(c);
-                int compressed_idx = cartesian_to_compressed_
-                    .at(connection.global_index());
+                int compressed_idx = cartesian_to_compressed_[connection.global_index()];
 
                 if ( compressed_idx >= 0 ) { // Ignore connections in inactive/remote cells.
                     wellCells.push_back(compressed_idx);
                 }
             }
 
+            if (wellCells.empty()) {
+                continue;
+            }
+
+            // A well may have several connections in the same cell. Sort
+            // and remove duplicates once per well, so that each neighbour
+            // set receives an ordered range which std::set inserts with an
+            // end hint instead of a full tree search per element.
+            std::sort(wellCells.begin(), wellCells.end());
+            wellCells.erase(std::unique(wellCells.begin(), wellCells.end()),
+                            wellCells.end());
+
             for (int cellIdx : wellCells) {
                 neighbors[cellIdx].insert(wellCells.begin(),
                                           wellCells.end());
@@ -339,11 +348,8 @@ namespace Opm {
                 well->init(&phase_usage_, depth_, gravity_, local_num_cells_, B_avg_);
             }
 
-            // update the updated cell flag
-            std::fill(is_cell_perforated_.begin(), is_cell_perforated_.end(), false);
-            for (auto& well : well_container_) {
-                well->updatePerforatedCell(is_cell_perforated_);
-            }
+            // update the perforated cells and their accumulated rates
+            updatePerforatedCells();
 
             // calculate the efficiency factors for each well
             calculateEfficiencyFactors(reportStepIdx);
@@ -594,11 +600,43 @@ namespace Opm {
         rate = 0;
         int elemIdx = context.globalSpaceIndex(spaceIdx, timeIdx);
 
-        if (!is_cell_perforated_[elemIdx])
+        const int cell_rate_idx = perforated_cell_index_[elemIdx];
+        if (cell_rate_idx < 0)
             return;
 
-        for (const auto& well : well_container_)
-            well->addCellRates(rate, elemIdx);
+        rate = cell_rates_[cell_rate_idx];
+    }
+
+
+
+    template<typename TypeTag>
+    void
+    BlackoilWellModel<TypeTag>::
+    updatePerforatedCells()
+    {
+        std::fill(perforated_cell_index_.begin(), perforated_cell_index_.end(), -1);
+        int num_perforated_cells = 0;
+        for (const auto& well : well_container_) {
+            well->updatePerforatedCell(perforated_cell_index_, num_perforated_cells);
+        }
+        cell_rates_.resize(num_perforated_cells);
+
+        updateCellRates();
+    }
+
+
+
+    template<typename TypeTag>
+    void
+    BlackoilWellModel<TypeTag>::
+    updateCellRates()
+    {
+        for (auto& rate : cell_rates_) {
+            rate = 0;
+        }
+        for (const auto& well : well_container_) {
+            well->addCellRates(cell_rates_, perforated_cell_index_);
+        }
     }
 
 
@@ -1055,6 +1093,7 @@ namespace Opm {
 
             maybeDoGasLiftOptimize(local_deferredLogger);
             assembleWellEq(dt, local_deferredLogger);
+            updateCellRates();
         } catch (const std::runtime_error& e) {
             exc_type = ExceptionType::RUNTIME_ERROR;
             exc_msg = e.what();
@@ -1267,6 +1306,44 @@ namespace Opm {
 
 
 
+    template<typename TypeTag>
+    bool
+    BlackoilWellModel<TypeTag>::
+    solveWellEquationsWithFrozenReservoir()
+    {
+        DeferredLogger local_deferredLogger;
+        bool converged = true;
+        auto exc_type = ExceptionType::NONE;
+        std::string exc_msg;
+        try {
+            if (localWellsActive()) {
+                // The perforations see the intensive quantities of the last
+                // reservoir assembly, which are not changed here.
+                for (auto& well : well_container_) {
+                    converged = well->solveWellEquation(ebosSimulator_, this->wellState(), this->groupState(), local_deferredLogger) && converged;
+                }
+                updatePrimaryVariables(local_deferredLogger);
+            }
+        } catch (const std::runtime_error& e) {
+            exc_type = ExceptionType::RUNTIME_ERROR;
+            exc_msg = e.what();
+        } catch (const std::invalid_argument& e) {
+            exc_type = ExceptionType::INVALID_ARGUMENT;
+            exc_msg = e.what();
+        } catch (const std::logic_error& e) {
+            exc_type = ExceptionType::LOGIC_ERROR;
+            exc_msg = e.what();
+        } catch (const std::exception& e) {
+            exc_type = ExceptionType::DEFAULT;
+            exc_msg = e.what();
+        }
+        logAndCheckForExceptionsAndThrow(local_deferredLogger, exc_type, "solveWellEquationsWithFrozenReservoir() failed: " + exc_msg, terminal_output_);
+        return ebosSimulator_.vanguard().grid().comm().min(converged);
+    }
+
+
+
+
     template<typename TypeTag>
     bool
     BlackoilWellModel<TypeTag>::
@@ -1396,11 +1473,21 @@ namespace Opm {
         std::set<std::string> switched_groups;
 
         if (checkGroupControls) {
-            // Check group individual constraints.
-            updateGroupIndividualControls(deferred_logger, switched_groups);
-
-            // Check group's constraints from higher levels.
-            updateGroupHigherControls(deferred_logger, switched_groups);
+            // The group rates do not change while the group controls are
+            // updated, so they are summed over the hierarchy and the
+            // processes once.
+            computeGroupRateSums();
+            try {
+                // Check group individual constraints.
+                updateGroupIndividualControls(deferred_logger, switched_groups);
+
+                // Check group's constraints from higher levels.
+                updateGroupHigherControls(deferred_logger, switched_groups);
+            } catch (...) {
+                clearGroupRateSums();
+                throw;
+            }
+            clearGroupRateSums();
 
             updateAndCommunicateGroupData();
 
@@ -1756,9 +1843,9 @@ namespace Opm {
     template<typename TypeTag>
     void
     BlackoilWellModel<TypeTag>::
-    setupCartesianToCompressed_(const int* global_cell, int number_of_cartesian_cells)
+    setupCartesianToCompressed_(const int* global_cell)
     {
-        cartesian_to_compressed_.resize(number_of_cartesian_cells, -1);
+        std::vector<int> cartesian_indices(local_num_cells_, -1);
         if (global_cell) {
             auto elemIt = ebosSimulator_.gridView().template begin</*codim=*/ 0>();
             for (unsigned i = 0; i < local_num_cells_; ++i) {
@@ -1766,16 +1853,17 @@ namespace Opm {
                 if (elemIt->partitionType() == Dune::InteriorEntity)
                 {
                     assert(ebosSimulator_.gridView().indexSet().index(*elemIt) == static_cast<int>(i));
-                    cartesian_to_compressed_[global_cell[i]] = i;
+                    cartesian_indices[i] = global_cell[i];
                 }
                 ++elemIt;
             }
         }
         else {
             for (unsigned i = 0; i < local_num_cells_; ++i) {
-                cartesian_to_compressed_[i] = i;
+                cartesian_indices[i] = i;
             }
         }
+        cartesian_to_compressed_ = CartesianToLocalMap(cartesian_indices);
 
     }
 
@@ -1926,7 +2014,7 @@ namespace Opm {
             elemCtx.updatePrimaryStencil(*elemIt);
             int elemIdx = elemCtx.globalSpaceIndex(0, 0);
 
-            if (!is_cell_perforated_[elemIdx]) {
+            if (perforated_cell_index_[elemIdx] < 0) {
                 continue;
             }
             elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
@@ -2212,10 +2300,7 @@ namespace Opm {
     BlackoilWellModel<TypeTag>::
     checkGroupProductionConstraints(const Group& group, DeferredLogger& deferred_logger) const {
 
-        const int reportStepIdx = ebosSimulator_.episodeIndex();
         const auto& summaryState = ebosSimulator_.vanguard().summaryState();
-        const auto& comm = ebosSimulator_.vanguard().grid().comm();
-        const auto& well_state = this->wellState();
 
         const auto controls = group.productionControls(summaryState);
         const Group::ProductionCMode& currentControl = this->groupState().production_control(group.name());
@@ -2224,11 +2309,7 @@ namespace Opm {
         {
             if (currentControl != Group::ProductionCMode::ORAT)
             {
-                double current_rate = 0.0;
-                current_rate += WellGroupHelpers::sumWellRates(group, schedule(), well_state, reportStepIdx, phase_usage_.phase_pos[BlackoilPhases::Liquid], false);
-
-                // sum over all nodes
-                current_rate = comm.sum(current_rate);
+                const double current_rate = groupRateSum(group, phase_usage_.phase_pos[BlackoilPhases::Liquid], false, false);
 
                 if (controls.oil_target < current_rate  ) {
                     return Group::ProductionCMode::ORAT;
@@ -2240,12 +2321,7 @@ namespace Opm {
         {
             if (currentControl != Group::ProductionCMode::WRAT)
             {
-
-                double current_rate = 0.0;
-                current_rate += WellGroupHelpers::sumWellRates(group, schedule(), well_state, reportStepIdx, phase_usage_.phase_pos[BlackoilPhases::Aqua], false);
-
-                // sum over all nodes
-                current_rate = comm.sum(current_rate);
+                const double current_rate = groupRateSum(group, phase_usage_.phase_pos[BlackoilPhases::Aqua], false, false);
 
                 if (controls.water_target < current_rate  ) {
                     return Group::ProductionCMode::WRAT;
@@ -2256,11 +2332,7 @@ namespace Opm {
         {
             if (currentControl != Group::ProductionCMode::GRAT)
             {
-                double current_rate = 0.0;
-                current_rate += WellGroupHelpers::sumWellRates(group, schedule(), well_state, reportStepIdx, phase_usage_.phase_pos[BlackoilPhases::Vapour], false);
-
-                // sum over all nodes
-                current_rate = comm.sum(current_rate);
+                const double current_rate = groupRateSum(group, phase_usage_.phase_pos[BlackoilPhases::Vapour], false, false);
                 if (controls.gas_target < current_rate  ) {
                     return Group::ProductionCMode::GRAT;
                 }
@@ -2271,11 +2343,8 @@ namespace Opm {
             if (currentControl != Group::ProductionCMode::LRAT)
             {
                 double current_rate = 0.0;
-                current_rate += WellGroupHelpers::sumWellRates(group, schedule(), well_state, reportStepIdx, phase_usage_.phase_pos[BlackoilPhases::Liquid], false);
-                current_rate += WellGroupHelpers::sumWellRates(group, schedule(), well_state, reportStepIdx, phase_usage_.phase_pos[BlackoilPhases::Aqua], false);
-
-                // sum over all nodes
-                current_rate = comm.sum(current_rate);
+                current_rate += groupRateSum(group, phase_usage_.phase_pos[BlackoilPhases::Liquid], false, false);
+                current_rate += groupRateSum(group, phase_usage_.phase_pos[BlackoilPhases::Aqua], false, false);
 
                 if (controls.liquid_target < current_rate  ) {
                      return Group::ProductionCMode::LRAT;
@@ -2292,12 +2361,9 @@ namespace Opm {
             if (currentControl != Group::ProductionCMode::RESV)
             {
                 double current_rate = 0.0;
-                current_rate += WellGroupHelpers::sumWellResRates(group, schedule(), well_state, reportStepIdx, phase_usage_.phase_pos[BlackoilPhases::Aqua], true);
-                current_rate += WellGroupHelpers::sumWellResRates(group, schedule(), well_state, reportStepIdx, phase_usage_.phase_pos[BlackoilPhases::Liquid], true);
-                current_rate += WellGroupHelpers::sumWellResRates(group, schedule(), well_state, reportStepIdx, phase_usage_.phase_pos[BlackoilPhases::Vapour], true);
-
-                // sum over all nodes
-                current_rate = comm.sum(current_rate);
+                current_rate += groupRateSum(group, phase_usage_.phase_pos[BlackoilPhases::Aqua], true, true);
+                current_rate += groupRateSum(group, phase_usage_.phase_pos[BlackoilPhases::Liquid], true, true);
+                current_rate += groupRateSum(group, phase_usage_.phase_pos[BlackoilPhases::Vapour], true, true);
 
                 if (controls.resv_target < current_rate  ) {
                     return Group::ProductionCMode::RESV;
@@ -2320,8 +2386,6 @@ namespace Opm {
 
         const int reportStepIdx = ebosSimulator_.episodeIndex();
         const auto& summaryState = ebosSimulator_.vanguard().summaryState();
-        const auto& comm = ebosSimulator_.vanguard().grid().comm();
-        const auto& well_state = this->wellState();
 
         int phasePos;
         if (phase == Phase::GAS && phase_usage_.phase_used[BlackoilPhases::Vapour] )
@@ -2340,11 +2404,7 @@ namespace Opm {
         {
             if (currentControl != Group::InjectionCMode::RATE)
             {
-                double current_rate = 0.0;
-                current_rate += WellGroupHelpers::sumWellRates(group, schedule(), well_state, reportStepIdx, phasePos, /*isInjector*/true);
-
-                // sum over all nodes
-                current_rate = comm.sum(current_rate);
+                const double current_rate = groupRateSum(group, phasePos, /*isInjector*/true, /*reservoir*/false);
 
                 if (controls.surface_max_rate < current_rate) {
                     return Group::InjectionCMode::RATE;
@@ -2355,10 +2415,7 @@ namespace Opm {
         {
             if (currentControl != Group::InjectionCMode::RESV)
             {
-                double current_rate = 0.0;
-                current_rate += WellGroupHelpers::sumWellResRates(group, schedule(), well_state, reportStepIdx, phasePos, /*isInjector*/true);
-                // sum over all nodes
-                current_rate = comm.sum(current_rate);
+                const double current_rate = groupRateSum(group, phasePos, /*isInjector*/true, /*reservoir*/true);
 
                 if (controls.resv_max_rate < current_rate) {
                     return Group::InjectionCMode::RESV;
@@ -2369,18 +2426,10 @@ namespace Opm {
         {
             if (currentControl != Group::InjectionCMode::REIN)
             {
-                double production_Rate = 0.0;
                 const Group& groupRein = schedule().getGroup(controls.reinj_group, reportStepIdx);
-                production_Rate += WellGroupHelpers::sumWellRates(groupRein, schedule(), well_state, reportStepIdx, phasePos, /*isInjector*/false);
+                const double production_Rate = groupRateSum(groupRein, phasePos, /*isInjector*/false, /*reservoir*/false);
 
-                // sum over all nodes
-                production_Rate = comm.sum(production_Rate);
-
-                double current_rate = 0.0;
-                current_rate += WellGroupHelpers::sumWellRates(group, schedule(), well_state, reportStepIdx, phasePos, /*isInjector*/true);
-
-                // sum over all nodes
-                current_rate = comm.sum(current_rate);
+                const double current_rate = groupRateSum(group, phasePos, /*isInjector*/true, /*reservoir*/false);
 
                 if (controls.target_reinj_fraction*production_Rate < current_rate) {
                     return Group::InjectionCMode::REIN;
@@ -2393,20 +2442,14 @@ namespace Opm {
             {
                 double voidage_rate = 0.0;
                 const Group& groupVoidage = schedule().getGroup(controls.voidage_group, reportStepIdx);
-                voidage_rate += WellGroupHelpers::sumWellResRates(groupVoidage, schedule(), well_state, reportStepIdx, phase_usage_.phase_pos[BlackoilPhases::Aqua], false);
-                voidage_rate += WellGroupHelpers::sumWellResRates(groupVoidage, schedule(), well_state, reportStepIdx, phase_usage_.phase_pos[BlackoilPhases::Liquid], false);
-                voidage_rate += WellGroupHelpers::sumWellResRates(groupVoidage, schedule(), well_state, reportStepIdx, phase_usage_.phase_pos[BlackoilPhases::Vapour], false);
-
-                // sum over all nodes
-                voidage_rate = comm.sum(voidage_rate);
+                voidage_rate += groupRateSum(groupVoidage, phase_usage_.phase_pos[BlackoilPhases::Aqua], false, true);
+                voidage_rate += groupRateSum(groupVoidage, phase_usage_.phase_pos[BlackoilPhases::Liquid], false, true);
+                voidage_rate += groupRateSum(groupVoidage, phase_usage_.phase_pos[BlackoilPhases::Vapour], false, true);
 
                 double total_rate = 0.0;
-                total_rate += WellGroupHelpers::sumWellResRates(group, schedule(), well_state, reportStepIdx, phase_usage_.phase_pos[BlackoilPhases::Aqua], true);
-                total_rate += WellGroupHelpers::sumWellResRates(group, schedule(), well_state, reportStepIdx, phase_usage_.phase_pos[BlackoilPhases::Liquid], true);
-                total_rate += WellGroupHelpers::sumWellResRates(group, schedule(), well_state, reportStepIdx, phase_usage_.phase_pos[BlackoilPhases::Vapour], true);
-
-                // sum over all nodes
-                total_rate = comm.sum(total_rate);
+                total_rate += groupRateSum(group, phase_usage_.phase_pos[BlackoilPhases::Aqua], true, true);
+                total_rate += groupRateSum(group, phase_usage_.phase_pos[BlackoilPhases::Liquid], true, true);
+                total_rate += groupRateSum(group, phase_usage_.phase_pos[BlackoilPhases::Vapour], true, true);
 
                 if (controls.target_void_fraction*voidage_rate < total_rate) {
                     return Group::InjectionCMode::VREP;
@@ -2616,17 +2659,6 @@ namespace Opm {
     void
     BlackoilWellModel<TypeTag>::
     updateGroupHigherControls(DeferredLogger& deferred_logger, std::set<std::string>& switched_groups)
-    {
-        const int reportStepIdx = ebosSimulator_.episodeIndex();
-        const Group& fieldGroup = schedule().getGroup("FIELD", reportStepIdx);
-        checkGroupHigherConstraints(fieldGroup, deferred_logger, switched_groups);
-    }
-
-
-    template<typename TypeTag>
-    void
-    BlackoilWellModel<TypeTag>::
-    checkGroupHigherConstraints(const Group& group, DeferredLogger& deferred_logger, std::set<std::string>& switched_groups)
     {
         // Set up coefficients for RESV <-> surface rate conversion.
         // Use the pvtRegionIdx from the top cell of the first well.
@@ -2657,6 +2689,17 @@ namespace Opm {
         std::vector<double> resv_coeff(phase_usage_.num_phases, 0.0);
         rateConverter_->calcCoeff(fipnum, pvtreg, resv_coeff);
 
+        const int reportStepIdx = ebosSimulator_.episodeIndex();
+        const Group& fieldGroup = schedule().getGroup("FIELD", reportStepIdx);
+        checkGroupHigherConstraints(fieldGroup, resv_coeff, deferred_logger, switched_groups);
+    }
+
+
+    template<typename TypeTag>
+    void
+    BlackoilWellModel<TypeTag>::
+    checkGroupHigherConstraints(const Group& group, const std::vector<double>& resv_coeff, DeferredLogger& deferred_logger, std::set<std::string>& switched_groups)
+    {
         const int reportStepIdx = ebosSimulator_.episodeIndex();
         const auto& summaryState = ebosSimulator_.vanguard().summaryState();
 
@@ -2667,9 +2710,7 @@ namespace Opm {
         if (!skip && group.isInjectionGroup()) {
             // Obtain rates for group.
             for (int phasePos = 0; phasePos < phase_usage_.num_phases; ++phasePos) {
-                const double local_current_rate = WellGroupHelpers::sumWellRates(group, schedule(), this->wellState(), reportStepIdx, phasePos, /* isInjector */ true);
-                // Sum over all processes
-                rates[phasePos] = comm.sum(local_current_rate);
+                rates[phasePos] = groupRateSum(group, phasePos, /* isInjector */ true, /* reservoir */ false);
             }
             const Phase all[] = { Phase::WATER, Phase::OIL, Phase::GAS };
             for (Phase phase : all) {
@@ -2704,9 +2745,7 @@ namespace Opm {
         if (!skip && group.isProductionGroup()) {
             // Obtain rates for group.
             for (int phasePos = 0; phasePos < phase_usage_.num_phases; ++phasePos) {
-                const double local_current_rate = WellGroupHelpers::sumWellRates(group, schedule(), this->wellState(), reportStepIdx, phasePos, /* isInjector */ false);
-                // Sum over all processes
-                rates[phasePos] = -comm.sum(local_current_rate);
+                rates[phasePos] = -groupRateSum(group, phasePos, /* isInjector */ false, /* reservoir */ false);
             }
             // Check higher up only if under individual (not FLD) control.
             const Group::ProductionCMode& currentControl = this->groupState().production_control(group.name());
@@ -2737,7 +2776,7 @@ namespace Opm {
 
         // call recursively down the group hiearchy
         for (const std::string& groupName : group.groups()) {
-            checkGroupHigherConstraints( schedule().getGroup(groupName, reportStepIdx), deferred_logger, switched_groups);
+            checkGroupHigherConstraints( schedule().getGroup(groupName, reportStepIdx), resv_coeff, deferred_logger, switched_groups);
          }
     }
 
@@ -2748,6 +2787,93 @@ namespace Opm {
 
 
 
+    template<typename TypeTag>
+    void
+    BlackoilWellModel<TypeTag>::
+    computeGroupRateSums()
+    {
+        const int reportStepIdx = ebosSimulator_.episodeIndex();
+        const Group& fieldGroup = schedule().getGroup("FIELD", reportStepIdx);
+        const auto& well_state = this->wellState();
+
+        std::map<std::string, std::vector<double>> production, injection, production_resv, injection_resv;
+        WellGroupHelpers::sumWellPhaseRatesAllGroups(well_state.wellRates(), fieldGroup, schedule(), well_state, reportStepIdx, /*injector*/ false, production);
+        WellGroupHelpers::sumWellPhaseRatesAllGroups(well_state.wellRates(), fieldGroup, schedule(), well_state, reportStepIdx, /*injector*/ true, injection);
+        WellGroupHelpers::sumWellPhaseRatesAllGroups(well_state.wellReservoirRates(), fieldGroup, schedule(), well_state, reportStepIdx, /*injector*/ false, production_resv);
+        WellGroupHelpers::sumWellPhaseRatesAllGroups(well_state.wellReservoirRates(), fieldGroup, schedule(), well_state, reportStepIdx, /*injector*/ true, injection_resv);
+
+        // The group hierarchy is the same on all processes, hence so is the
+        // (sorted) order of the maps.  Pack all rates into a single buffer
+        // to sum them over the processes with one reduction.
+        const int np = numPhases();
+        std::vector<double> buffer;
+        buffer.reserve(4 * np * production.size());
+        for (const auto* rates : {&production, &injection, &production_resv, &injection_resv}) {
+            for (const auto& entry : *rates) {
+                buffer.insert(buffer.end(), entry.second.begin(), entry.second.end());
+            }
+        }
+
+        const auto& comm = ebosSimulator_.vanguard().grid().comm();
+        if (comm.size() > 1 && !buffer.empty()) {
+            comm.sum(buffer.data(), static_cast<int>(buffer.size()));
+        }
+
+        auto& group_rate_sums = this->group_rate_sums_.emplace();
+        auto it = buffer.begin();
+        auto unpack = [&it, np]()
+        {
+            std::vector<double> rate(it, it + np);
+            it += np;
+            return rate;
+        };
+        for (const auto& entry : production) {
+            group_rate_sums[entry.first].production = unpack();
+        }
+        for (const auto& entry : injection) {
+            group_rate_sums[entry.first].injection = unpack();
+        }
+        for (const auto& entry : production_resv) {
+            group_rate_sums[entry.first].production_resv = unpack();
+        }
+        for (const auto& entry : injection_resv) {
+            group_rate_sums[entry.first].injection_resv = unpack();
+        }
+    }
+
+
+    template<typename TypeTag>
+    void
+    BlackoilWellModel<TypeTag>::
+    clearGroupRateSums()
+    {
+        this->group_rate_sums_.reset();
+    }
+
+
+    template<typename TypeTag>
+    double
+    BlackoilWellModel<TypeTag>::
+    groupRateSum(const Group& group, const int phasePos, const bool injector, const bool reservoir) const
+    {
+        if (this->group_rate_sums_.has_value()) {
+            const auto& sums = this->group_rate_sums_->at(group.name());
+            const auto& rates = injector
+                ? (reservoir ? sums.injection_resv : sums.injection)
+                : (reservoir ? sums.production_resv : sums.production);
+            return rates[phasePos];
+        }
+
+        const int reportStepIdx = ebosSimulator_.episodeIndex();
+        const double local_rate = reservoir
+            ? WellGroupHelpers::sumWellResRates(group, schedule(), this->wellState(), reportStepIdx, phasePos, injector)
+            : WellGroupHelpers::sumWellRates(group, schedule(), this->wellState(), reportStepIdx, phasePos, injector);
+
+        // sum over all nodes
+        return ebosSimulator_.vanguard().grid().comm().sum(local_rate);
+    }
+
+
     template<typename TypeTag>
     void
     BlackoilWellModel<TypeTag>::
@@ -17,6 +17,7 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
 #include <iterator>
 
 #include <opm/json/JsonObject.hpp>
@@ -30,104 +31,196 @@ GroupState::GroupState(std::size_t np) :
 {}
 
 bool GroupState::operator==(const GroupState& other) const {
-    return this->m_production_rates == other.m_production_rates &&
+    return this->num_phases == other.num_phases &&
+           this->group_names == other.group_names &&
+           this->m_data == other.m_data &&
+           this->m_has_data == other.m_has_data &&
            this->production_controls == other.production_controls &&
-           this->prod_red_rates == other.prod_red_rates &&
-           this->inj_red_rates == other.inj_red_rates &&
-           this->inj_resv_rates == other.inj_resv_rates &&
-           this->inj_potentials == other.inj_potentials &&
-           this->inj_rein_rates == other.inj_rein_rates &&
-           this->inj_vrep_rate == other.inj_vrep_rate &&
-           this->m_grat_sales_target == other.m_grat_sales_target &&
+           this->m_has_production_control == other.m_has_production_control &&
            this->injection_controls == other.injection_controls;
 }
 
 //-------------------------------------------------------------------------
 
+std::size_t GroupState::width(Quantity q) const {
+    if (q == Quantity::InjectionVrepRate || q == Quantity::GratSalesTarget)
+        return 1;
+
+    return this->num_phases;
+}
+
+std::size_t GroupState::offset(Quantity q, std::size_t group_index) const {
+    std::size_t block_offset = 0;
+    for (std::size_t qi = 0; qi < static_cast<std::size_t>(q); qi++)
+        block_offset += this->width(static_cast<Quantity>(qi));
+
+    return block_offset * this->group_names.size() + group_index * this->width(q);
+}
+
+std::size_t GroupState::flag_index(Quantity q, std::size_t group_index) const {
+    return static_cast<std::size_t>(q) * this->group_names.size() + group_index;
+}
+
+std::optional<std::size_t> GroupState::find_group(const std::string& gname) const {
+    auto iter = std::lower_bound(this->group_names.begin(), this->group_names.end(), gname);
+    if (iter == this->group_names.end() || *iter != gname)
+        return std::nullopt;
+
+    return std::distance(this->group_names.begin(), iter);
+}
+
+std::size_t GroupState::group_index(const std::string& gname) const {
+    auto index = this->find_group(gname);
+    if (!index.has_value())
+        throw std::logic_error("No such group");
+
+    return *index;
+}
+
+/*
+  Groups are inserted in sorted name order, so that the layout of the buffer
+  only depends on the set of groups and is the same on all processes. This
+  moves the existing data, but it only happens the first time a group is
+  updated.
+*/
+std::size_t GroupState::add_group(const std::string& gname) {
+    auto iter = std::lower_bound(this->group_names.begin(), this->group_names.end(), gname);
+    const std::size_t new_index = std::distance(this->group_names.begin(), iter);
+    const std::size_t old_size = this->group_names.size();
+
+    const auto old_data = std::move(this->m_data);
+    const auto old_has_data = std::move(this->m_has_data);
+    this->group_names.insert(iter, gname);
+    this->m_data.assign(this->offset(Quantity::NumQuantities, 0), 0.0);
+    this->m_has_data.assign(num_quantities * this->group_names.size(), 0);
+
+    std::size_t old_offset = 0;
+    for (std::size_t qi = 0; qi < num_quantities; qi++) {
+        const auto q = static_cast<Quantity>(qi);
+        const auto w = this->width(q);
+        for (std::size_t old_index = 0; old_index < old_size; old_index++) {
+            const auto index = old_index < new_index ? old_index : old_index + 1;
+            std::copy_n(old_data.begin() + old_offset + old_index * w, w,
+                        this->m_data.begin() + this->offset(q, index));
+            this->m_has_data[this->flag_index(q, index)] = old_has_data[qi * old_size + old_index];
+        }
+        old_offset += old_size * w;
+    }
+
+    this->production_controls.insert(this->production_controls.begin() + new_index, Group::ProductionCMode::NONE);
+    this->m_has_production_control.insert(this->m_has_production_control.begin() + new_index, 0);
+    return new_index;
+}
+
+bool GroupState::has(Quantity q, const std::string& gname) const {
+    auto index = this->find_group(gname);
+    if (!index.has_value())
+        return false;
+
+    return this->m_has_data[this->flag_index(q, *index)];
+}
+
+void GroupState::update(Quantity q, const std::string& gname, const double* values) {
+    auto index = this->find_group(gname);
+    if (!index.has_value())
+        index = this->add_group(gname);
+
+    std::copy_n(values, this->width(q), this->m_data.begin() + this->offset(q, *index));
+    this->m_has_data[this->flag_index(q, *index)] = 1;
+}
+
+const double* GroupState::get(Quantity q, const std::string& gname) const {
+    auto index = this->group_index(gname);
+    if (!this->m_has_data[this->flag_index(q, index)])
+        throw std::logic_error("No such group");
+
+    return this->m_data.data() + this->offset(q, index);
+}
+
+//-------------------------------------------------------------------------
+
+std::size_t GroupState::data_size() const {
+    return this->offset(Quantity::InjectionPotentials, 0);
+}
+
+std::size_t GroupState::collect(double * data) const {
+    const auto size = this->data_size();
+    std::copy_n(this->m_data.begin(), size, data);
+    return size;
+}
+
+std::size_t GroupState::distribute(const double * data) {
+    const auto size = this->data_size();
+    std::copy_n(data, size, this->m_data.begin());
+    return size;
+}
+
+//-------------------------------------------------------------------------
+
 bool GroupState::has_production_rates(const std::string& gname) const {
-    auto group_iter = this->m_production_rates.find(gname);
-    return (group_iter != this->m_production_rates.end());
+    return this->has(Quantity::ProductionRates, gname);
 }
 
 void GroupState::update_production_rates(const std::string& gname, const std::vector<double>& rates) {
     if (rates.size() != this->num_phases)
         throw std::logic_error("Wrong number of phases");
 
-    this->m_production_rates[gname] = rates;
+    this->update(Quantity::ProductionRates, gname, rates.data());
 }
 
-const std::vector<double>& GroupState::production_rates(const std::string& gname) const {
-    auto group_iter = this->m_production_rates.find(gname);
-    if (group_iter == this->m_production_rates.end())
-        throw std::logic_error("No such group");
-
-    return group_iter->second;
+GroupState::RateView GroupState::production_rates(const std::string& gname) const {
+    return { this->get(Quantity::ProductionRates, gname), this->num_phases };
 }
 
 //-------------------------------------------------------------------------
 
 bool GroupState::has_production_reduction_rates(const std::string& gname) const {
-    auto group_iter = this->prod_red_rates.find(gname);
-    return (group_iter != this->prod_red_rates.end());
+    return this->has(Quantity::ProductionReductionRates, gname);
 }
 
 void GroupState::update_production_reduction_rates(const std::string& gname, const std::vector<double>& rates) {
     if (rates.size() != this->num_phases)
         throw std::logic_error("Wrong number of phases");
 
-    this->prod_red_rates[gname] = rates;
+    this->update(Quantity::ProductionReductionRates, gname, rates.data());
 }
 
-const std::vector<double>& GroupState::production_reduction_rates(const std::string& gname) const {
-    auto group_iter = this->prod_red_rates.find(gname);
-    if (group_iter == this->prod_red_rates.end())
-        throw std::logic_error("No such group");
-
-    return group_iter->second;
+GroupState::RateView GroupState::production_reduction_rates(const std::string& gname) const {
+    return { this->get(Quantity::ProductionReductionRates, gname), this->num_phases };
 }
 
 //-------------------------------------------------------------------------
 
 bool GroupState::has_injection_reduction_rates(const std::string& gname) const {
-    auto group_iter = this->inj_red_rates.find(gname);
-    return (group_iter != this->inj_red_rates.end());
+    return this->has(Quantity::InjectionReductionRates, gname);
 }
 
 void GroupState::update_injection_reduction_rates(const std::string& gname, const std::vector<double>& rates) {
     if (rates.size() != this->num_phases)
         throw std::logic_error("Wrong number of phases");
 
-    this->inj_red_rates[gname] = rates;
+    this->update(Quantity::InjectionReductionRates, gname, rates.data());
 }
 
-const std::vector<double>& GroupState::injection_reduction_rates(const std::string& gname) const {
-    auto group_iter = this->inj_red_rates.find(gname);
-    if (group_iter == this->inj_red_rates.end())
-        throw std::logic_error("No such group");
-
-    return group_iter->second;
+GroupState::RateView GroupState::injection_reduction_rates(const std::string& gname) const {
+    return { this->get(Quantity::InjectionReductionRates, gname), this->num_phases };
 }
 
 //-------------------------------------------------------------------------
 
 bool GroupState::has_injection_reservoir_rates(const std::string& gname) const {
-    auto group_iter = this->inj_resv_rates.find(gname);
-    return (group_iter != this->inj_resv_rates.end());
+    return this->has(Quantity::InjectionReservoirRates, gname);
 }
 
 void GroupState::update_injection_reservoir_rates(const std::string& gname, const std::vector<double>& rates) {
     if (rates.size() != this->num_phases)
         throw std::logic_error("Wrong number of phases");
 
-    this->inj_resv_rates[gname] = rates;
+    this->update(Quantity::InjectionReservoirRates, gname, rates.data());
 }
 
-const std::vector<double>& GroupState::injection_reservoir_rates(const std::string& gname) const {
-    auto group_iter = this->inj_resv_rates.find(gname);
-    if (group_iter == this->inj_resv_rates.end())
-        throw std::logic_error("No such group");
-
-    return group_iter->second;
+GroupState::RateView GroupState::injection_reservoir_rates(const std::string& gname) const {
+    return { this->get(Quantity::InjectionReservoirRates, gname), this->num_phases };
 }
 
 //-------------------------------------------------------------------------
@@ -136,47 +229,35 @@ void GroupState::update_injection_rein_rates(const std::string& gname, const std
     if (rates.size() != this->num_phases)
         throw std::logic_error("Wrong number of phases");
 
-    this->inj_rein_rates[gname] = rates;
+    this->update(Quantity::InjectionReinRates, gname, rates.data());
 }
 
-const std::vector<double>& GroupState::injection_rein_rates(const std::string& gname) const {
-    auto group_iter = this->inj_rein_rates.find(gname);
-    if (group_iter == this->inj_rein_rates.end())
-        throw std::logic_error("No such group");
-
-    return group_iter->second;
+GroupState::RateView GroupState::injection_rein_rates(const std::string& gname) const {
+    return { this->get(Quantity::InjectionReinRates, gname), this->num_phases };
 }
 
 //-------------------------------------------------------------------------
 
 void GroupState::update_injection_vrep_rate(const std::string& gname, double rate) {
-    this->inj_vrep_rate[gname] = rate;
+    this->update(Quantity::InjectionVrepRate, gname, &rate);
 }
 
 double GroupState::injection_vrep_rate(const std::string& gname) const {
-    auto group_iter = this->inj_vrep_rate.find(gname);
-    if (group_iter == this->inj_vrep_rate.end())
-        throw std::logic_error("No such group");
-
-    return group_iter->second;
+    return *this->get(Quantity::InjectionVrepRate, gname);
 }
 
 //-------------------------------------------------------------------------
 
 void GroupState::update_grat_sales_target(const std::string& gname, double target) {
-    this->m_grat_sales_target[gname] = target;
+    this->update(Quantity::GratSalesTarget, gname, &target);
 }
 
 double GroupState::grat_sales_target(const std::string& gname) const {
-    auto group_iter = this->m_grat_sales_target.find(gname);
-    if (group_iter == this->m_grat_sales_target.end())
-        throw std::logic_error("No such group");
-
-    return group_iter->second;
+    return *this->get(Quantity::GratSalesTarget, gname);
 }
 
 bool GroupState::has_grat_sales_target(const std::string& gname) const {
-    return (this->m_grat_sales_target.count(gname) > 0);
+    return this->has(Quantity::GratSalesTarget, gname);
 }
 
 //-------------------------------------------------------------------------
@@ -185,37 +266,37 @@ void GroupState::update_injection_potentials(const std::string& gname, const std
     if (potentials.size() != this->num_phases)
         throw std::logic_error("Wrong number of phases");
 
-    this->inj_potentials[gname] = potentials;
+    this->update(Quantity::InjectionPotentials, gname, potentials.data());
 }
 
-const std::vector<double>& GroupState::injection_potentials(const std::string& gname) const {
-    auto group_iter = this->inj_potentials.find(gname);
-    if (group_iter == this->inj_potentials.end())
-        throw std::logic_error("No such group");
-
-    return group_iter->second;
+GroupState::RateView GroupState::injection_potentials(const std::string& gname) const {
+    return { this->get(Quantity::InjectionPotentials, gname), this->num_phases };
 }
 
 //-------------------------------------------------------------------------
 
 bool GroupState::has_production_control(const std::string& gname) const {
-    auto group_iter = this->production_controls.find(gname);
-    if (group_iter == this->production_controls.end())
+    auto index = this->find_group(gname);
+    if (!index.has_value())
         return false;
 
-    return true;
+    return this->m_has_production_control[*index];
 }
 
 void GroupState::production_control(const std::string& gname, Group::ProductionCMode cmode) {
-    this->production_controls[gname] = cmode;
+    auto index = this->find_group(gname);
+    if (!index.has_value())
+        index = this->add_group(gname);
+
+    this->production_controls[*index] = cmode;
+    this->m_has_production_control[*index] = 1;
 }
 
 Group::ProductionCMode GroupState::production_control(const std::string& gname) const {
-    auto group_iter = this->production_controls.find(gname);
-    if (group_iter == this->production_controls.end())
+    if (!this->has_production_control(gname))
         throw std::logic_error("Could not find any control for production group: " + gname);
 
-    return group_iter->second;
+    return this->production_controls[this->group_index(gname)];
 }
 
 //-------------------------------------------------------------------------
@@ -239,49 +320,40 @@ Group::InjectionCMode GroupState::injection_control(const std::string& gname, Ph
 
 //-------------------------------------------------------------------------
 
-namespace {
-
-template <typename T>
-void dump_vector(Json::JsonObject& root, const std::string& key, const std::vector<T>& data) {
-    auto data_obj = root.add_array(key);
-    for (const auto& rate : data)
-        data_obj.add(rate);
-}
-
-
-template <typename T>
-void dump_groupmap(Json::JsonObject& root, const std::string& key, const std::map<std::string, std::vector<T>>& group_data) {
-    auto map_obj = root.add_object(key);
-    for (const auto& [gname, data] : group_data)
-        dump_vector(map_obj, gname, data);
-}
-
-
-template <typename T>
-void dump_groupmap(Json::JsonObject& root, const std::string& key, const std::map<std::string, T>& group_data) {
-    auto map_obj = root.add_object(key);
-    for (const auto& [gname, value] : group_data)
-        map_obj.add_item(gname, value);
-}
-
-}
-
 std::string GroupState::dump() const
 {
     Json::JsonObject root;
-    dump_groupmap(root, "production_rates", this->m_production_rates);
-    dump_groupmap(root, "prod_red_rates", this->prod_red_rates);
-    dump_groupmap(root, "inj_red_rates", this->inj_red_rates);
-    dump_groupmap(root, "inj_resv_rates", this->inj_resv_rates);
-    dump_groupmap(root, "inj_potentials", this->inj_potentials);
-    dump_groupmap(root, "inj_rein_rates", this->inj_rein_rates);
-    dump_groupmap(root, "vrep_rate", this->inj_vrep_rate);
-    dump_groupmap(root, "grat_sales_target", this->m_grat_sales_target);
+    auto dump_quantity = [&root, this](const std::string& key, Quantity q) {
+        auto map_obj = root.add_object(key);
+        for (std::size_t index = 0; index < this->group_names.size(); index++) {
+            if (!this->m_has_data[this->flag_index(q, index)])
+                continue;
+
+            const auto* values = this->m_data.data() + this->offset(q, index);
+            if (q == Quantity::InjectionVrepRate || q == Quantity::GratSalesTarget)
+                map_obj.add_item(this->group_names[index], values[0]);
+            else {
+                auto data_obj = map_obj.add_array(this->group_names[index]);
+                for (std::size_t p = 0; p < this->width(q); p++)
+                    data_obj.add(values[p]);
+            }
+        }
+    };
+
+    dump_quantity("production_rates", Quantity::ProductionRates);
+    dump_quantity("prod_red_rates", Quantity::ProductionReductionRates);
+    dump_quantity("inj_red_rates", Quantity::InjectionReductionRates);
+    dump_quantity("inj_resv_rates", Quantity::InjectionReservoirRates);
+    dump_quantity("inj_potentials", Quantity::InjectionPotentials);
+    dump_quantity("inj_rein_rates", Quantity::InjectionReinRates);
+    dump_quantity("vrep_rate", Quantity::InjectionVrepRate);
+    dump_quantity("grat_sales_target", Quantity::GratSalesTarget);
     {
-        std::map<std::string, int> int_controls;
-        for (const auto& [gname, control] : this->production_controls)
-            int_controls.insert({gname, static_cast<int>(control)});
-        dump_groupmap(root, "production_controls", int_controls);
+        auto map_obj = root.add_object("production_controls");
+        for (std::size_t index = 0; index < this->group_names.size(); index++) {
+            if (this->m_has_production_control[index])
+                map_obj.add_item(this->group_names[index], static_cast<int>(this->production_controls[index]));
+        }
     }
     {
         std::map<std::string, std::vector<std::pair<Opm::Phase, Group::InjectionCMode>>> inj_cntrl;
@@ -20,7 +20,10 @@
 #ifndef OPM_GROUPSTATE_HEADER_INCLUDED
 #define OPM_GROUPSTATE_HEADER_INCLUDED
 
+#include <cstddef>
 #include <map>
+#include <optional>
+#include <string>
 #include <vector>
 
 #include <opm/core/props/BlackoilPhases.hpp>
@@ -29,32 +32,67 @@
 
 namespace Opm {
 
+/*
+  The GroupState class holds the dynamic group quantities: the phase rates
+  used by the group control machinery, the active controls and a few scalar
+  targets. All floating point quantities live in one contiguous buffer,
+  laid out quantity by quantity with one slot per group; the groups are
+  given dense indices in sorted name order when they are first updated.
+  The quantities which must be summed over processes are placed first in
+  the buffer, so communicate_rates() reduces a prefix of it in place and a
+  copy of the whole state is a handful of memcpy-able vectors.
+*/
+
 class GroupState {
 public:
+    /*
+      Non-owning view of the num_phases values of one group quantity. The
+      view is invalidated when a new group is added to the GroupState.
+    */
+    class RateView {
+    public:
+        RateView(const double* data, std::size_t size) :
+            m_data(data),
+            m_size(size)
+        {}
+
+        std::size_t size() const { return this->m_size; }
+        const double* data() const { return this->m_data; }
+        const double* begin() const { return this->m_data; }
+        const double* end() const { return this->m_data + this->m_size; }
+        double operator[](std::size_t index) const { return this->m_data[index]; }
+
+        operator std::vector<double>() const { return { this->begin(), this->end() }; }
+
+    private:
+        const double* m_data;
+        std::size_t m_size;
+    };
+
     explicit GroupState(std::size_t num_phases);
     bool operator==(const GroupState& other) const;
 
     bool has_production_rates(const std::string& gname) const;
     void update_production_rates(const std::string& gname, const std::vector<double>& rates);
-    const std::vector<double>& production_rates(const std::string& gname) const;
+    RateView production_rates(const std::string& gname) const;
 
     bool has_production_reduction_rates(const std::string& gname) const;
     void update_production_reduction_rates(const std::string& gname, const std::vector<double>& rates);
-    const std::vector<double>& production_reduction_rates(const std::string& gname) const;
+    RateView production_reduction_rates(const std::string& gname) const;
 
     bool has_injection_reduction_rates(const std::string& gname) const;
     void update_injection_reduction_rates(const std::string& gname, const std::vector<double>& rates);
-    const std::vector<double>& injection_reduction_rates(const std::string& gname) const;
+    RateView injection_reduction_rates(const std::string& gname) const;
 
     bool has_injection_reservoir_rates(const std::string& gname) const;
     void update_injection_reservoir_rates(const std::string& gname, const std::vector<double>& rates);
-    const std::vector<double>& injection_reservoir_rates(const std::string& gname) const;
+    RateView injection_reservoir_rates(const std::string& gname) const;
 
     void update_injection_rein_rates(const std::string& gname, const std::vector<double>& rates);
-    const std::vector<double>& injection_rein_rates(const std::string& gname) const;
+    RateView injection_rein_rates(const std::string& gname) const;
 
     void update_injection_potentials(const std::string& gname, const std::vector<double>& potentials);
-    const std::vector<double>& injection_potentials(const std::string& gname) const;
+    RateView injection_potentials(const std::string& gname) const;
 
     void update_injection_vrep_rate(const std::string& gname, double rate);
     double injection_vrep_rate(const std::string& gname) const;
@@ -71,6 +109,11 @@ public:
     void injection_control(const std::string& gname, Phase phase, Group::InjectionCMode cmode);
     Group::InjectionCMode injection_control(const std::string& gname, Phase phase) const;
 
+    /*
+      The data_size(), collect() and distribute() methods give access to the
+      part of the buffer which is summed over processes in
+      communicate_rates().
+    */
     std::size_t data_size() const;
     std::size_t collect(double * data) const;
     std::size_t distribute(const double * data);
@@ -79,90 +122,52 @@ public:
     template<class Comm>
     void communicate_rates(const Comm& comm)
     {
-        // Note that injection_group_vrep_rates is handled separate from
-        // the forAllGroupData() function, since it contains single doubles,
-        // not vectors.
-
-        // Create a function that calls some function
-        // for all the individual data items to simplify
-        // the further code.
-        auto iterateContainer = [](auto& container, auto& func) {
-            for (auto& x : container) {
-                func(x.second);
-            }
-        };
-
-
-        auto forAllGroupData = [&](auto& func) {
-            iterateContainer(m_production_rates, func);
-            iterateContainer(prod_red_rates, func);
-            iterateContainer(inj_red_rates, func);
-            iterateContainer(inj_resv_rates, func);
-            iterateContainer(inj_rein_rates, func);
-        };
-
-        // Compute the size of the data.
-        std::size_t sz = 0;
-        auto computeSize = [&sz](const auto& v) {
-            sz += v.size();
-        };
-        forAllGroupData(computeSize);
-        sz += this->inj_vrep_rate.size();
-
-        // Make a vector and collect all data into it.
-        std::vector<double> data(sz);
-        std::size_t pos = 0;
-
-
-
-        // That the collect function mutates the vector v is an artifact for
-        // testing.
-        auto collect = [&data, &pos](auto& v) {
-            for (auto& x : v) {
-                data[pos++] = x;
-                x = -1;
-            }
-        };
-        forAllGroupData(collect);
-        for (const auto& x : this->inj_vrep_rate) {
-            data[pos++] = x.second;
-        }
-        if (pos != sz)
-            throw std::logic_error("Internal size mismatch when collecting groupData");
-
-        // Communicate it with a single sum() call.
-        comm.sum(data.data(), data.size());
-
-        // Distribute the summed vector to the data items.
-        pos = 0;
-        auto distribute = [&data, &pos](auto& v) {
-            for (auto& x : v) {
-                x = data[pos++];
-            }
-        };
-        forAllGroupData(distribute);
-        for (auto& x : this->inj_vrep_rate) {
-            x.second = data[pos++];
-        }
-        if (pos != sz)
-            throw std::logic_error("Internal size mismatch when distributing groupData");
+        // The production, reduction, reservoir and REIN rates and the VREP
+        // rate form a prefix of the buffer, which is summed in place with a
+        // single sum() call. Groups are ordered by name on all processes.
+        comm.sum(this->m_data.data(), this->data_size());
     }
 
     std::string dump() const;
 
 
 private:
-    std::size_t num_phases;
-    std::map<std::string, std::vector<double>> m_production_rates;
-    std::map<std::string, Group::ProductionCMode> production_controls;
-    std::map<std::string, std::vector<double>> prod_red_rates;
-    std::map<std::string, std::vector<double>> inj_red_rates;
-    std::map<std::string, std::vector<double>> inj_resv_rates;
-    std::map<std::string, std::vector<double>> inj_potentials;
-    std::map<std::string, std::vector<double>> inj_rein_rates;
-    std::map<std::string, double> inj_vrep_rate;
-    std::map<std::string, double> m_grat_sales_target;
+    /*
+      The quantities stored in m_data. The order is significant: all the
+      quantities before InjectionPotentials are summed in communicate_rates().
+    */
+    enum class Quantity : std::size_t {
+        ProductionRates = 0,
+        ProductionReductionRates,
+        InjectionReductionRates,
+        InjectionReservoirRates,
+        InjectionReinRates,
+        InjectionVrepRate,
+        InjectionPotentials,
+        GratSalesTarget,
+        NumQuantities
+    };
+
+    static constexpr std::size_t num_quantities = static_cast<std::size_t>(Quantity::NumQuantities);
+
+    std::size_t width(Quantity q) const;
+    std::size_t offset(Quantity q, std::size_t group_index) const;
+    std::size_t flag_index(Quantity q, std::size_t group_index) const;
+
+    std::optional<std::size_t> find_group(const std::string& gname) const;
+    std::size_t group_index(const std::string& gname) const;
+    std::size_t add_group(const std::string& gname);
+
+    bool has(Quantity q, const std::string& gname) const;
+    void update(Quantity q, const std::string& gname, const double* values);
+    const double* get(Quantity q, const std::string& gname) const;
 
+    std::size_t num_phases;
+    std::vector<std::string> group_names;
+    std::vector<double> m_data;
+    std::vector<char> m_has_data;
+    std::vector<Group::ProductionCMode> production_controls;
+    std::vector<char> m_has_production_control;
 
     std::map<std::pair<Phase, std::string>, Group::InjectionCMode> injection_controls;
 };
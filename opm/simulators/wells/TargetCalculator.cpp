@@ -190,7 +190,7 @@ double InjectionTargetCalculator::groupTarget(const Group::InjectionControls& ct
         return ctrl.target_reinj_fraction * production_rate;
     }
     case Group::InjectionCMode::VREP: {
-        const std::vector<double>& group_injection_reductions = this->group_state_.injection_reduction_rates(this->group_name_);
+        const auto group_injection_reductions = this->group_state_.injection_reduction_rates(this->group_name_);
         double voidage_rate = group_state_.injection_vrep_rate(ctrl.voidage_group) * ctrl.target_void_fraction;
         double inj_reduction = 0.0;
         if (ctrl.phase != Phase::WATER)
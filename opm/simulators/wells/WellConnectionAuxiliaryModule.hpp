@@ -27,6 +27,10 @@
 
 #include <opm/parser/eclipse/EclipseState/EclipseState.hpp>
 
+#include <opm/simulators/utils/CartesianToLocalMap.hpp>
+
+#include <algorithm>
+
 namespace Opm
 {
 template<class TypeTag>
@@ -45,18 +49,8 @@ public:
                                   const Dune::CpGrid& grid)
     {
         // Create cartesian to compressed mapping
-        const auto& globalCell = grid.globalCell();
         const auto& cartesianSize = grid.logicalCartesianSize();
-
-        auto size = cartesianSize[0]*cartesianSize[1]*cartesianSize[2];
-
-        std::vector<int> cartesianToCompressed(size, -1);
-        auto begin = globalCell.begin();
-
-        for ( auto cell = begin, end= globalCell.end(); cell != end; ++cell )
-        {
-          cartesianToCompressed[ *cell ] = cell - begin;
-        }
+        const CartesianToLocalMap cartesianToCompressed(grid.globalCell());
 
         const auto& schedule_wells = schedule.getWellsatEnd();
         wells_.reserve(schedule_wells.size());
@@ -88,6 +82,9 @@ public:
             {
                 std::sort(compressed_well_perforations.begin(),
                           compressed_well_perforations.end());
+                compressed_well_perforations.erase(std::unique(compressed_well_perforations.begin(),
+                                                               compressed_well_perforations.end()),
+                                                   compressed_well_perforations.end());
 
                 wells_.push_back(compressed_well_perforations);
             }
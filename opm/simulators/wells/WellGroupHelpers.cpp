@@ -39,8 +39,9 @@
 #include <stack>
 
 namespace {
+    template <class RateVec>
     Opm::GuideRate::RateVector
-    getGuideRateVector(const std::vector<double>& rates, const Opm::PhaseUsage& pu)
+    getGuideRateVector(const RateVec& rates, const Opm::PhaseUsage& pu)
     {
         using Opm::BlackoilPhases;
 
@@ -58,6 +59,46 @@ namespace {
 
         return {oilRate, gasRate, waterRate};
     }
+
+    /// Call addWellRates(wellRates, factor) for every open well directly in
+    /// group which is owned by this process, and which is an injector if
+    /// injector is true and a producer otherwise. The factor is the
+    /// efficiency factor of the well, negated for producers.
+    template <class AddWellRates>
+    void forEachGroupWellRates(const Opm::WellContainer<std::vector<double>>& rates,
+                               const Opm::Group& group,
+                               const Opm::Schedule& schedule,
+                               const Opm::WellStateFullyImplicitBlackoil& wellState,
+                               const int reportStepIdx,
+                               const bool injector,
+                               AddWellRates&& addWellRates)
+    {
+        const auto& end = wellState.wellMap().end();
+
+        for (const std::string& wellName : group.wells()) {
+            const auto& it = wellState.wellMap().find(wellName);
+            if (it == end) // the well is not found
+                continue;
+
+            int well_index = it->second[0];
+
+            if (! wellState.wellIsOwned(well_index, wellName) ) // Only sum once
+            {
+                continue;
+            }
+
+            const auto& wellEcl = schedule.getWell(wellName, reportStepIdx);
+            // only count producers or injectors
+            if ((wellEcl.isProducer() && injector) || (wellEcl.isInjector() && !injector))
+                continue;
+
+            if (wellEcl.getStatus() == Opm::Well::Status::SHUT)
+                continue;
+
+            const double factor = wellEcl.getEfficiencyFactor();
+            addWellRates(rates[well_index], injector ? factor : -factor);
+        }
+    }
 } // namespace Anonymous
 
 namespace Opm
@@ -140,37 +181,45 @@ namespace WellGroupHelpers
             const Group& groupTmp = schedule.getGroup(groupName, reportStepIdx);
             rate += sumWellPhaseRates(rates, groupTmp, schedule, wellState, reportStepIdx, phasePos, injector);
         }
-        const auto& end = wellState.wellMap().end();
-
-        for (const std::string& wellName : group.wells()) {
-            const auto& it = wellState.wellMap().find(wellName);
-            if (it == end) // the well is not found
-                continue;
-
-            int well_index = it->second[0];
+        forEachGroupWellRates(rates, group, schedule, wellState, reportStepIdx, injector,
+                              [&rate, phasePos](const std::vector<double>& well_rates, const double factor)
+                              {
+                                  rate += factor * well_rates[phasePos];
+                              });
+        const auto& gefac = group.getGroupEfficiencyFactor();
+        return gefac * rate;
+    }
 
-            if (! wellState.wellIsOwned(well_index, wellName) ) // Only sum once
-            {
-                continue;
+    std::vector<double> sumWellPhaseRatesAllGroups(const WellContainer<std::vector<double>>& rates,
+                                                   const Group& group,
+                                                   const Schedule& schedule,
+                                                   const WellStateFullyImplicitBlackoil& wellState,
+                                                   const int reportStepIdx,
+                                                   const bool injector,
+                                                   std::map<std::string, std::vector<double>>& groupRates)
+    {
+        const int np = wellState.numPhases();
+        std::vector<double> rate(np, 0.0);
+        for (const std::string& groupName : group.groups()) {
+            const Group& groupTmp = schedule.getGroup(groupName, reportStepIdx);
+            const auto subGroupRate = sumWellPhaseRatesAllGroups(rates, groupTmp, schedule, wellState, reportStepIdx, injector, groupRates);
+            for (int phase = 0; phase < np; ++phase) {
+                rate[phase] += subGroupRate[phase];
             }
-
-            const auto& wellEcl = schedule.getWell(wellName, reportStepIdx);
-            // only count producers or injectors
-            if ((wellEcl.isProducer() && injector) || (wellEcl.isInjector() && !injector))
-                continue;
-
-            if (wellEcl.getStatus() == Well::Status::SHUT)
-                continue;
-
-            double factor = wellEcl.getEfficiencyFactor();
-            const auto& well_rates = rates[well_index];
-            if (injector)
-                rate += factor * well_rates[phasePos];
-            else
-                rate -= factor * well_rates[phasePos];
         }
+        forEachGroupWellRates(rates, group, schedule, wellState, reportStepIdx, injector,
+                              [&rate, np](const std::vector<double>& well_rates, const double factor)
+                              {
+                                  for (int phase = 0; phase < np; ++phase) {
+                                      rate[phase] += factor * well_rates[phase];
+                                  }
+                              });
         const auto& gefac = group.getGroupEfficiencyFactor();
-        return gefac * rate;
+        for (auto& r : rate) {
+            r *= gefac;
+        }
+        groupRates[group.name()] = rate;
+        return rate;
     }
 
     double sumWellRates(const Group& group,
@@ -270,7 +319,7 @@ namespace WellGroupHelpers
             case Group::GuideRateInjTarget::NETV:
             {
                 guideRateValue = group_state.injection_vrep_rate(group.name());
-                const std::vector<double>& injRES = group_state.injection_reservoir_rates(group.name());
+                const auto injRES = group_state.injection_reservoir_rates(group.name());
                 if (phase != Phase::OIL && pu.phase_used[BlackoilPhases::Liquid])
                     guideRateValue -= injRES[pu.phase_pos[BlackoilPhases::Liquid]];
                 if (phase != Phase::GAS && pu.phase_used[BlackoilPhases::Vapour])
@@ -596,7 +645,8 @@ namespace WellGroupHelpers
         // from the corresponding groups.
         std::map<std::string, std::vector<double>> node_inflows;
         for (const auto& node : leaf_nodes) {
-            node_inflows[node] = group_state.production_rates(node);
+            const auto rates = group_state.production_rates(node);
+            node_inflows[node].assign(rates.begin(), rates.end());
             // Add the ALQ amounts to the gas rates if requested.
             if (network.node(node).add_gas_lift_gas()) {
                 const auto& group = schedule.getGroup(node, report_time_step);
@@ -1041,8 +1091,8 @@ namespace WellGroupHelpers
         auto localFraction = [&](const std::string& child) { return fcalc.localFraction(child, name); };
 
         auto localReduction = [&](const std::string& group_name) {
-            const std::vector<double>& groupTargetReductions = group_state.production_reduction_rates(group_name);
-            return tcalc.calcModeRateFromRates(groupTargetReductions);
+            const auto groupTargetReductions = group_state.production_reduction_rates(group_name);
+            return tcalc.calcModeRateFromRates(groupTargetReductions.data());
         };
 
         const double orig_target = tcalc.groupTarget(group.productionControls(summaryState));
@@ -1165,7 +1215,7 @@ namespace WellGroupHelpers
         auto localFraction = [&](const std::string& child) { return fcalc.localFraction(child, name); };
 
         auto localReduction = [&](const std::string& group_name) {
-            const std::vector<double>& groupTargetReductions = group_state.injection_reduction_rates(group_name);
+            const auto groupTargetReductions = group_state.injection_reduction_rates(group_name);
             return tcalc.calcModeRateFromRates(groupTargetReductions);
         };
 
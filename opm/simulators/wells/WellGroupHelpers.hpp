@@ -69,6 +69,18 @@ namespace WellGroupHelpers
                              const int phasePos,
                              const bool injector);
 
+    /// Compute sumWellPhaseRates() for all phases of group and of every
+    /// group below it in a single bottom-up traversal of the hierarchy.
+    /// The rates of each group are stored in groupRates, and the rates of
+    /// group are returned.
+    std::vector<double> sumWellPhaseRatesAllGroups(const WellContainer<std::vector<double>>& rates,
+                                                   const Group& group,
+                                                   const Schedule& schedule,
+                                                   const WellStateFullyImplicitBlackoil& wellState,
+                                                   const int reportStepIdx,
+                                                   const bool injector,
+                                                   std::map<std::string, std::vector<double>>& groupRates);
+
     double sumWellRates(const Group& group,
                         const Schedule& schedule,
                         const WellStateFullyImplicitBlackoil& wellState,
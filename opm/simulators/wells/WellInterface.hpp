@@ -236,7 +236,10 @@ namespace Opm
         // Add well contributions to matrix
         virtual void addWellContributions(SparseMatrixAdapter&) const = 0;
 
-        void addCellRates(RateVector& rates, int cellIdx) const;
+        // Add the connection rates of the well to the accumulated rates of
+        // the perforated cells, indexed through perforated_cell_index.
+        void addCellRates(std::vector<RateVector>& cell_rates,
+                          const std::vector<int>& perforated_cell_index) const;
 
         Scalar volumetricSurfaceRateForConnection(int cellIdx, int phaseIdx) const;
 
@@ -284,7 +287,10 @@ namespace Opm
                                   WellState& well_state,
                                   DeferredLogger& deferred_logger) const;
 
-        void solveWellEquation(const Simulator& ebosSimulator,
+        /// Iterate the well equations with the current reservoir state.
+        /// \return false if they did not converge, the well state is
+        ///         then restored.
+        bool solveWellEquation(const Simulator& ebosSimulator,
                                WellState& well_state,
                                const GroupState& group_state,
                                DeferredLogger& deferred_logger);
@@ -24,6 +24,7 @@
 
 #include <opm/parser/eclipse/EclipseState/Schedule/Well/WellTestState.hpp>
 
+#include <opm/simulators/utils/CartesianToLocalMap.hpp>
 #include <opm/simulators/utils/DeferredLoggingErrorHelpers.hpp>
 #include <opm/simulators/wells/PerforationData.hpp>
 #include <opm/simulators/wells/ParallelWellInfo.hpp>
@@ -259,7 +260,7 @@ void WellInterfaceGeneric::setWellEfficiencyFactor(const double efficiency_facto
     well_efficiency_factor_ = efficiency_factor;
 }
 
-void WellInterfaceGeneric::setRepRadiusPerfLength(const std::vector<int>& cartesian_to_compressed)
+void WellInterfaceGeneric::setRepRadiusPerfLength(const CartesianToLocalMap& cartesian_to_compressed)
 {
     const int nperf = number_of_perforations_;
 
@@ -308,11 +309,16 @@ void WellInterfaceGeneric::setDynamicThpLimit(const double thp_limit)
     dynamic_thp_limit_ = thp_limit;
 }
 
-void WellInterfaceGeneric::updatePerforatedCell(std::vector<bool>& is_cell_perforated)
+void WellInterfaceGeneric::updatePerforatedCell(std::vector<int>& perforated_cell_index,
+                                                int& num_perforated_cells)
 {
-
+    perf_index_of_cell_.clear();
     for (int perf_idx = 0; perf_idx<number_of_perforations_; ++perf_idx) {
-        is_cell_perforated[well_cells_[perf_idx]] = true;
+        int& cell_index = perforated_cell_index[well_cells_[perf_idx]];
+        if (cell_index < 0) {
+            cell_index = num_perforated_cells++;
+        }
+        perf_index_of_cell_.emplace(well_cells_[perf_idx], perf_idx);
     }
 }
 
@@ -29,11 +29,13 @@
 #include <map>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace Opm
 {
 
+class CartesianToLocalMap;
 class DeferredLogger;
 class GuideRate;
 class ParallelWellInfo;
@@ -88,10 +90,11 @@ public:
     void setVFPProperties(const VFPProperties* vfp_properties_arg);
     void setGuideRate(const GuideRate* guide_rate_arg);
     void setWellEfficiencyFactor(const double efficiency_factor);
-    void setRepRadiusPerfLength(const std::vector<int>& cartesian_to_compressed);
+    void setRepRadiusPerfLength(const CartesianToLocalMap& cartesian_to_compressed);
     void setWsolvent(const double wsolvent);
     void setDynamicThpLimit(const double thp_limit);
-    void updatePerforatedCell(std::vector<bool>& is_cell_perforated);
+    void updatePerforatedCell(std::vector<int>& perforated_cell_index,
+                              int& num_perforated_cells);
 
     /// Returns true if the well has one or more THP limits/constraints.
     bool wellHasTHPConstraints(const SummaryState& summaryState) const;
@@ -196,6 +199,10 @@ protected:
     // cell index for each well perforation
     std::vector<int> well_cells_;
 
+    // index of the first perforation of the well in each perforated cell,
+    // filled by updatePerforatedCell()
+    std::unordered_map<int, int> perf_index_of_cell_;
+
     // well index for each perforation
     std::vector<double> well_index_;
 
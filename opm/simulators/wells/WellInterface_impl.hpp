@@ -965,7 +965,7 @@ namespace Opm
     }
 
     template<typename TypeTag>
-    void
+    bool
     WellInterface<TypeTag>::
     solveWellEquation(const Simulator& ebosSimulator,
                       WellState& well_state,
@@ -973,7 +973,7 @@ namespace Opm
                       DeferredLogger& deferred_logger)
     {
         if (!this->isOperable())
-            return;
+            return true;
 
         // keep a copy of the original well state
         const WellState well_state0 = well_state;
@@ -987,6 +987,7 @@ namespace Opm
                                   + std::to_string(max_iter) + " iterations");
             well_state = well_state0;
         }
+        return converged;
     }
 
 
@@ -1017,13 +1018,13 @@ namespace Opm
 
     template<typename TypeTag>
     void
-    WellInterface<TypeTag>::addCellRates(RateVector& rates, int cellIdx) const
+    WellInterface<TypeTag>::addCellRates(std::vector<RateVector>& cell_rates,
+                                         const std::vector<int>& perforated_cell_index) const
     {
         for (int perfIdx = 0; perfIdx < number_of_perforations_; ++perfIdx) {
-            if (cells()[perfIdx] == cellIdx) {
-                for (int i = 0; i < RateVector::dimension; ++i) {
-                    rates[i] += connectionRates_[perfIdx][i];
-                }
+            auto& rates = cell_rates[perforated_cell_index[cells()[perfIdx]]];
+            for (int i = 0; i < RateVector::dimension; ++i) {
+                rates[i] += connectionRates_[perfIdx][i];
             }
         }
     }
@@ -1031,11 +1032,10 @@ namespace Opm
     template<typename TypeTag>
     typename WellInterface<TypeTag>::Scalar
     WellInterface<TypeTag>::volumetricSurfaceRateForConnection(int cellIdx, int phaseIdx) const {
-        for (int perfIdx = 0; perfIdx < number_of_perforations_; ++perfIdx) {
-            if (cells()[perfIdx] == cellIdx) {
-                const unsigned activeCompIdx = Indices::canonicalToActiveComponentIndex(FluidSystem::solventComponentIndex(phaseIdx));
-                return connectionRates_[perfIdx][activeCompIdx].value();
-            }
+        const auto perf = this->perf_index_of_cell_.find(cellIdx);
+        if (perf != this->perf_index_of_cell_.end()) {
+            const unsigned activeCompIdx = Indices::canonicalToActiveComponentIndex(FluidSystem::solventComponentIndex(phaseIdx));
+            return connectionRates_[perf->second][activeCompIdx].value();
         }
         // this is not thread safe
         OPM_THROW(std::invalid_argument, "The well with name " + name()
@@ -2213,7 +2213,7 @@ namespace Opm
         };
 
         auto localReduction = [&](const std::string& group_name) {
-            const std::vector<double>& groupTargetReductions = group_state.injection_reduction_rates(group_name);
+            const auto groupTargetReductions = group_state.injection_reduction_rates(group_name);
             return tcalc.calcModeRateFromRates(groupTargetReductions);
         };
 
@@ -2308,8 +2308,8 @@ namespace Opm
         };
 
         auto localReduction = [&](const std::string& group_name) {
-            const std::vector<double>& groupTargetReductions = group_state.production_reduction_rates(group_name);
-            return tcalc.calcModeRateFromRates(groupTargetReductions);
+            const auto groupTargetReductions = group_state.production_reduction_rates(group_name);
+            return tcalc.calcModeRateFromRates(groupTargetReductions.data());
         };
 
         const double orig_target = tcalc.groupTarget(group.productionControls(summaryState));
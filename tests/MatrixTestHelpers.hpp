@@ -0,0 +1,78 @@
+/*
+  Copyright 2021 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef OPM_MATRIXTESTHELPERS_HEADER
+#define OPM_MATRIXTESTHELPERS_HEADER
+
+#include <dune/common/fmatrix.hh>
+#include <dune/common/fvector.hh>
+#include <dune/istl/bcrsmatrix.hh>
+#include <dune/istl/bvector.hh>
+
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+/// Scalar, possibly nonsymmetric tridiagonal matrix of a path of n cells,
+/// with the given diagonal, sub-diagonal and super-diagonal entries. Cell i
+/// of the path has the index perm[i], the identity if perm is empty.
+template <class Matrix = Dune::BCRSMatrix<Dune::FieldMatrix<double, 1, 1>>>
+Matrix createTridiagonal(const std::size_t n,
+                         const double diagonal,
+                         const double lower,
+                         const double upper,
+                         std::vector<std::size_t> perm = {})
+{
+    if (perm.empty()) {
+        perm.resize(n);
+        std::iota(perm.begin(), perm.end(), 0);
+    }
+
+    Matrix A(n, n, 3*n - 2, Matrix::random);
+    for (std::size_t i = 0; i < n; ++i)
+        A.setrowsize(perm[i], (i > 0) + 1 + (i < n - 1));
+    A.endrowsizes();
+    for (std::size_t i = 0; i < n; ++i) {
+        A.addindex(perm[i], perm[i]);
+        if (i > 0)
+            A.addindex(perm[i], perm[i - 1]);
+        if (i < n - 1)
+            A.addindex(perm[i], perm[i + 1]);
+    }
+    A.endindices();
+    for (std::size_t i = 0; i < n; ++i) {
+        A[perm[i]][perm[i]] = diagonal;
+        if (i > 0)
+            A[perm[i]][perm[i - 1]] = lower;
+        if (i < n - 1)
+            A[perm[i]][perm[i + 1]] = upper;
+    }
+    return A;
+}
+
+/// Return ||A x - b|| / ||b||.
+template <class Matrix, class Vector>
+double relativeResidual(const Matrix& A, const Vector& x, const Vector& b)
+{
+    Vector r(b.size());
+    A.mv(x, r);
+    r -= b;
+    return r.two_norm() / b.two_norm();
+}
+
+#endif // OPM_MATRIXTESTHELPERS_HEADER
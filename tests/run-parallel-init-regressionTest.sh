@@ -0,0 +1,42 @@
+#!/bin/bash
+
+# This runs the initialization step of a simulator in serial and in
+# parallel, then compares the transmissibilities and the NNC lists of
+# the two INIT files. Meant to track regressions that make the INIT
+# file depend on the domain decomposition.
+
+INPUT_DATA_PATH="$1"
+RESULT_PATH="$2"
+BINPATH="$3"
+FILENAME="$4"
+ABS_TOL="$5"
+REL_TOL="$6"
+COMPARE_ECL_COMMAND="$7"
+EXE_NAME="${8}"
+shift 8
+TEST_ARGS="$@"
+
+rm -Rf ${RESULT_PATH}
+mkdir -p ${RESULT_PATH}
+cd ${RESULT_PATH}
+${BINPATH}/${EXE_NAME} ${TEST_ARGS} --enable-dry-run=true --output-dir=${RESULT_PATH}
+
+test $? -eq 0 || exit 1
+mkdir mpi
+cd mpi
+mpirun -np 4 ${BINPATH}/${EXE_NAME} ${TEST_ARGS} --enable-dry-run=true --output-dir=${RESULT_PATH}/mpi
+test $? -eq 0 || exit 1
+cd ..
+
+ecode=0
+for keyword in TRANX TRANY TRANZ NNC1 NNC2 TRANNNC
+do
+  echo "=== Executing comparison of ${keyword} in the INIT file ==="
+  ${COMPARE_ECL_COMMAND} -t INIT -k ${keyword} ${RESULT_PATH}/${FILENAME} ${RESULT_PATH}/mpi/${FILENAME} ${ABS_TOL} ${REL_TOL}
+  if [ $? -ne 0 ]
+  then
+    ecode=1
+  fi
+done
+
+exit $ecode
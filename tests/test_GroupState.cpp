@@ -33,6 +33,14 @@ public:
     void sum(const double *, std::size_t) const {}
 };
 
+class DoublingCommunicator {
+public:
+    void sum(double * data, std::size_t size) const {
+        for (std::size_t i = 0; i < size; i++)
+            data[i] *= 2;
+    }
+};
+
 
 
 BOOST_AUTO_TEST_CASE(GroupStateCreate) {
@@ -47,7 +55,7 @@ BOOST_AUTO_TEST_CASE(GroupStateCreate) {
     BOOST_CHECK(gs.has_production_rates("AGROUP"));
 
     BOOST_CHECK_THROW( gs.production_rates("NO_SUCH_GROUP"), std::exception );
-    auto r2 = gs.production_rates("AGROUP");
+    std::vector<double> r2 = gs.production_rates("AGROUP");
     BOOST_CHECK( r2 == rates );
 
     gs.update_injection_rein_rates("CGROUP", rates);
@@ -70,6 +78,49 @@ BOOST_AUTO_TEST_CASE(GroupStateCreate) {
 }
 
 
+BOOST_AUTO_TEST_CASE(GroupStateMultipleGroups) {
+    std::size_t num_phases{3};
+    GroupState gs(num_phases);
+
+    gs.update_production_rates("CGROUP", {1,2,3});
+    gs.update_injection_vrep_rate("CGROUP", 10);
+    gs.production_control("CGROUP", Group::ProductionCMode::ORAT);
+    gs.update_production_rates("AGROUP", {4,5,6});
+    gs.update_injection_potentials("BGROUP", {7,8,9});
+    gs.update_grat_sales_target("BGROUP", 11);
+
+    // Adding groups out of order must not disturb the existing values.
+    BOOST_CHECK( std::vector<double>(gs.production_rates("CGROUP")) == std::vector<double>({1,2,3}) );
+    BOOST_CHECK( std::vector<double>(gs.production_rates("AGROUP")) == std::vector<double>({4,5,6}) );
+    BOOST_CHECK_EQUAL( gs.injection_vrep_rate("CGROUP"), 10 );
+    BOOST_CHECK( gs.production_control("CGROUP") == Group::ProductionCMode::ORAT );
+    BOOST_CHECK( !gs.has_production_control("AGROUP") );
+    BOOST_CHECK( !gs.has_production_rates("BGROUP") );
+    BOOST_CHECK_THROW( gs.production_rates("BGROUP"), std::exception );
+    BOOST_CHECK_THROW( gs.injection_vrep_rate("AGROUP"), std::exception );
+
+    // Only the rates are summed over processes; the potentials and the
+    // sales target are local quantities.
+    DoublingCommunicator comm;
+    gs.communicate_rates(comm);
+    BOOST_CHECK( std::vector<double>(gs.production_rates("CGROUP")) == std::vector<double>({2,4,6}) );
+    BOOST_CHECK( std::vector<double>(gs.production_rates("AGROUP")) == std::vector<double>({8,10,12}) );
+    BOOST_CHECK_EQUAL( gs.injection_vrep_rate("CGROUP"), 20 );
+    BOOST_CHECK( std::vector<double>(gs.injection_potentials("BGROUP")) == std::vector<double>({7,8,9}) );
+    BOOST_CHECK_EQUAL( gs.grat_sales_target("BGROUP"), 11 );
+
+    std::vector<double> buffer(gs.data_size());
+    BOOST_CHECK_EQUAL( gs.collect(buffer.data()), buffer.size() );
+    auto gs2 = GroupState(num_phases);
+    gs2 = gs;
+    for (auto& x : buffer)
+        x = 0;
+    gs2.distribute(buffer.data());
+    BOOST_CHECK( std::vector<double>(gs2.production_rates("AGROUP")) == std::vector<double>({0,0,0}) );
+    BOOST_CHECK( std::vector<double>(gs2.injection_potentials("BGROUP")) == std::vector<double>({7,8,9}) );
+}
+
+
 BOOST_AUTO_TEST_CASE(GroupStateDump) {
     std::size_t num_phases{3};
     GroupState gs(num_phases);
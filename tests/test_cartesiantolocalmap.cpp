@@ -0,0 +1,69 @@
+/*
+  Copyright 2021 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#include <opm/simulators/utils/CartesianToLocalMap.hpp>
+
+#define BOOST_TEST_MODULE CartesianToLocalMapTest
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+using namespace Opm;
+
+BOOST_AUTO_TEST_CASE(EmptyMap)
+{
+    CartesianToLocalMap map;
+    BOOST_CHECK_EQUAL(map.size(), 0U);
+    BOOST_CHECK_EQUAL(map[0], -1);
+    BOOST_CHECK_EQUAL(map[42], -1);
+}
+
+BOOST_AUTO_TEST_CASE(SortedCartesianIndices)
+{
+    const std::vector<int> cartesianIndex { 1, 4, 5, 9, 100 };
+    CartesianToLocalMap map(cartesianIndex);
+
+    BOOST_CHECK_EQUAL(map.size(), cartesianIndex.size());
+    for (std::size_t i = 0; i < cartesianIndex.size(); ++i) {
+        BOOST_CHECK_EQUAL(map[cartesianIndex[i]], static_cast<int>(i));
+    }
+
+    BOOST_CHECK_EQUAL(map[0], -1);
+    BOOST_CHECK_EQUAL(map[2], -1);
+    BOOST_CHECK_EQUAL(map[99], -1);
+    BOOST_CHECK_EQUAL(map[101], -1);
+}
+
+BOOST_AUTO_TEST_CASE(UnsortedAndSkippedCells)
+{
+    // Cells with negative Cartesian index, e.g. overlap cells, are not mapped.
+    const std::vector<int> cartesianIndex { 17, 3, -1, 8, 0, -1 };
+    CartesianToLocalMap map(cartesianIndex);
+
+    BOOST_CHECK_EQUAL(map.size(), 4U);
+    BOOST_CHECK_EQUAL(map[17], 0);
+    BOOST_CHECK_EQUAL(map[3], 1);
+    BOOST_CHECK_EQUAL(map[8], 3);
+    BOOST_CHECK_EQUAL(map[0], 4);
+    BOOST_CHECK_EQUAL(map[-1], -1);
+    BOOST_CHECK_EQUAL(map[5], -1);
+    BOOST_CHECK(map.memoryUsage() >= 4 * 2 * sizeof(int));
+}
@@ -2,6 +2,10 @@
 
 #define BOOST_TEST_MODULE MILU0Test
 
+#include<algorithm>
+#include<cstdlib>
+#include<numeric>
+#include<random>
 #include<vector>
 #include<memory>
 
@@ -11,6 +15,8 @@
 #include<dune/common/fvector.hh>
 #include<opm/simulators/linalg/ParallelOverlappingILU0.hpp>
 
+#include "MatrixTestHelpers.hpp"
+
 #include <boost/test/unit_test.hpp>
 #include <boost/version.hpp>
 #if BOOST_VERSION / 100000 == 1 && BOOST_VERSION / 100 % 1000 < 71
@@ -196,3 +202,54 @@ BOOST_AUTO_TEST_CASE(MILULaplace4)
 {
     test<4>();
 }
+
+// Tridiagonal matrix of a path of n cells, numbered in a random order.
+Dune::BCRSMatrix<Dune::FieldMatrix<double, 1, 1>> setupShuffledPath(std::size_t n)
+{
+    std::vector<std::size_t> perm(n);
+    std::iota(perm.begin(), perm.end(), 0);
+    std::shuffle(perm.begin(), perm.end(), std::mt19937(42));
+    return createTridiagonal(n, 4.0, -1.0, -2.0, perm);
+}
+
+BOOST_AUTO_TEST_CASE(ReverseCuthillMcKee)
+{
+    const std::size_t n = 50;
+    const auto A = setupShuffledPath(n);
+    const auto ordering = Opm::detail::reverseCuthillMcKee(A, n);
+
+    auto sorted = ordering;
+    std::sort(sorted.begin(), sorted.end());
+    std::vector<std::size_t> identity(n);
+    std::iota(identity.begin(), identity.end(), 0);
+    BOOST_CHECK(sorted == identity);
+
+    // A path renumbered by RCM is tridiagonal again.
+    for (auto row = A.begin(); row != A.end(); ++row)
+        for (auto col = row->begin(); col != row->end(); ++col)
+            BOOST_CHECK(std::abs(static_cast<long>(ordering[row.index()]) - static_cast<long>(ordering[col.index()])) <= 1);
+
+    // Rows beyond the given number keep their position.
+    const auto partial = Opm::detail::reverseCuthillMcKee(A, n - 10);
+    for (std::size_t i = n - 10; i < n; ++i)
+        BOOST_CHECK_EQUAL(partial[i], i);
+}
+
+BOOST_AUTO_TEST_CASE(ILU0WithRCMOrdering)
+{
+    using Matrix = Dune::BCRSMatrix<Dune::FieldMatrix<double, 1, 1>>;
+    using Vector = Dune::BlockVector<Dune::FieldVector<double, 1>>;
+    const std::size_t n = 50;
+    const auto A = setupShuffledPath(n);
+
+    // In RCM order the matrix is tridiagonal, where ILU0 is exact.
+    Opm::ParallelOverlappingILU0<Matrix, Vector, Vector> ilu(A, 0, 1.0, Opm::MILU_VARIANT::ILU,
+                                                             false, false, true);
+    Vector e(n), b(n), x(n);
+    e = 1.0;
+    A.mv(e, b);
+    x = 0.0;
+    ilu.apply(x, b);
+    for (std::size_t i = 0; i < n; ++i)
+        BOOST_CHECK_CLOSE(x[i][0], 1.0, 1e-10);
+}
@@ -0,0 +1,71 @@
+/*
+  Copyright 2021 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE OPM_test_PressureDirectSolver
+#include <boost/test/unit_test.hpp>
+
+#if HAVE_SUITESPARSE_UMFPACK
+
+#include <opm/simulators/linalg/PressureDirectSolver.hpp>
+
+#include "MatrixTestHelpers.hpp"
+
+#include <dune/common/fmatrix.hh>
+#include <dune/common/fvector.hh>
+#include <dune/istl/bcrsmatrix.hh>
+#include <dune/istl/bvector.hh>
+
+using Matrix = Dune::BCRSMatrix<Dune::FieldMatrix<double, 1, 1>>;
+using Vector = Dune::BlockVector<Dune::FieldVector<double, 1>>;
+
+BOOST_AUTO_TEST_CASE(SolveAndRefactorise)
+{
+    const int n = 10;
+    Matrix matrix = createTridiagonal(n, 4.0, -1.0, -2.0);
+    Vector b(n);
+    for (int i = 0; i < n; ++i) {
+        b[i] = 1.0 + i;
+    }
+
+    Opm::PressureDirectSolver<Matrix, Vector> solver(matrix);
+    Vector x(n);
+    x = 0.0;
+    solver.apply(x, b);
+    BOOST_CHECK_LT(relativeResidual(matrix, x, b), 1e-12);
+
+    // Unchanged values must not trigger a refactorisation.
+    BOOST_CHECK(!solver.update(matrix));
+
+    matrix[3][3] = 7.0;
+    BOOST_CHECK(solver.update(matrix));
+    solver.apply(x, b);
+    BOOST_CHECK_LT(relativeResidual(matrix, x, b), 1e-12);
+}
+
+#else
+
+// Do nothing if UMFPack is not available.
+BOOST_AUTO_TEST_CASE(DummyTest)
+{
+    BOOST_REQUIRE(true);
+}
+
+#endif
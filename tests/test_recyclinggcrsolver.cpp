@@ -0,0 +1,104 @@
+/*
+  Copyright 2021 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE OPM_test_RecyclingGCRSolver
+#include <boost/test/unit_test.hpp>
+
+#include <opm/simulators/linalg/RecyclingGCRSolver.hpp>
+
+#include "MatrixTestHelpers.hpp"
+
+#include <dune/common/fmatrix.hh>
+#include <dune/common/fvector.hh>
+#include <dune/istl/bcrsmatrix.hh>
+#include <dune/istl/bvector.hh>
+#include <dune/istl/operators.hh>
+#include <dune/istl/preconditioners.hh>
+#include <dune/istl/scalarproducts.hh>
+
+#include <cmath>
+
+using Matrix = Dune::BCRSMatrix<Dune::FieldMatrix<double, 1, 1>>;
+using Vector = Dune::BlockVector<Dune::FieldVector<double, 1>>;
+
+namespace
+{
+
+Vector createRhs(const int n)
+{
+    Vector b(n);
+    for (int i = 0; i < n; ++i) {
+        b[i] = 1.0 + std::sin(i);
+    }
+    return b;
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(RecyclingReducesIterations)
+{
+    const int n = 400;
+    Matrix matrix = createTridiagonal(n, 2.6, -1.0, -1.5);
+    Dune::MatrixAdapter<Matrix, Vector, Vector> op(matrix);
+    Dune::SeqScalarProduct<Vector> sp;
+    Dune::SeqJac<Matrix, Vector, Vector> prec(matrix, 1, 1.0);
+    Dune::RecyclingGCRSolver<Vector> solver(op, sp, prec, 1e-8, 30, 8, 1000, 0);
+
+    Dune::InverseOperatorResult res1;
+    Vector x(n);
+    x = 0.0;
+    Vector b = createRhs(n);
+    solver.apply(x, b, res1);
+    BOOST_CHECK(res1.converged);
+    BOOST_CHECK_LT(relativeResidual(matrix, x, createRhs(n)), 1e-6);
+
+    // A slightly changed matrix, as between two Newton iterations.
+    for (int i = 0; i < n; ++i) {
+        matrix[i][i] += 1e-4 * i;
+    }
+    Dune::InverseOperatorResult res2;
+    x = 0.0;
+    b = createRhs(n);
+    solver.apply(x, b, res2);
+    BOOST_CHECK(res2.converged);
+    BOOST_CHECK_LT(relativeResidual(matrix, x, createRhs(n)), 1e-6);
+    BOOST_CHECK_LT(res2.iterations, res1.iterations);
+}
+
+BOOST_AUTO_TEST_CASE(NoRecycling)
+{
+    const int n = 100;
+    Matrix matrix = createTridiagonal(n, 3.0, -1.0, -1.5);
+    Dune::MatrixAdapter<Matrix, Vector, Vector> op(matrix);
+    Dune::SeqScalarProduct<Vector> sp;
+    Dune::SeqJac<Matrix, Vector, Vector> prec(matrix, 1, 1.0);
+    Dune::RecyclingGCRSolver<Vector> solver(op, sp, prec, 1e-8, 10, 0, 1000, 0);
+
+    for (int k = 0; k < 2; ++k) {
+        Dune::InverseOperatorResult res;
+        Vector x(n);
+        x = 0.0;
+        Vector b = createRhs(n);
+        solver.apply(x, b, res);
+        BOOST_CHECK(res.converged);
+        BOOST_CHECK_LT(relativeResidual(matrix, x, createRhs(n)), 1e-6);
+    }
+}